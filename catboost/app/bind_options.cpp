@@ -759,6 +759,23 @@ static void BindTreeParams(NLastGetopt::TOpts* parserPtr, NJson::TJsonValue* pla
                 (*plainJsonPtr)["sparse_features_conflict_fraction"] = fraction;
             });
 
+    parser.AddLongOption("feature-preselection-count",
+                         "CPU only. If nonzero, score all features on a document subsample first "
+                         "and compute exact scores only for this number of the best ones. "
+                         "Supported only for single host training of symmetric trees with non-pairwise losses.")
+            .RequiredArgument("int")
+            .Handler1T<ui32>([plainJsonPtr](ui32 count) {
+                (*plainJsonPtr)["feature_preselection_count"] = count;
+            });
+
+    parser.AddLongOption("feature-preselection-sample-rate",
+                         "CPU only. Fraction of sampled documents used for feature preselection. "
+                         "Should be a real value in (0, 1] interval.")
+            .RequiredArgument("float")
+            .Handler1T<float>([plainJsonPtr](float rate) {
+                (*plainJsonPtr)["feature_preselection_sample_rate"] = rate;
+            });
+
     parser.AddLongOption("random-strength")
         .RequiredArgument("float")
         .Handler1T<float>([plainJsonPtr](float randomStrength) {
@@ -858,8 +875,9 @@ static void BindTreeParams(NLastGetopt::TOpts* parserPtr, NJson::TJsonValue* pla
         .Handler1T<float>([plainJsonPtr](float rate) {
             (*plainJsonPtr)["subsample"] = rate;
         })
-        .Help("Controls sample rate for bagging. Could be used if bootstrap-type is Poisson, Bernoulli or MVS. \
-            Possible values are from (0, 1]; 0.66 by default for Bernoulli and Poisson, 0.8 by default for MVS."
+        .Help("Controls sample rate for bagging. Could be used if bootstrap-type is Poisson, Bernoulli, MVS or GOSS. \
+            Possible values are from (0, 1]; 0.66 by default for Bernoulli and Poisson, 0.8 by default for MVS, \
+            0.1 by default for GOSS (sample rate of objects outside the top gradients)."
         );
 
     parser
@@ -870,6 +888,16 @@ static void BindTreeParams(NLastGetopt::TOpts* parserPtr, NJson::TJsonValue* pla
         })
         .Help("Controls the weight of denominator in MVS procedure.");
 
+    parser
+        .AddLongOption("goss-top-rate")
+        .RequiredArgument("Float")
+        .Handler1T<float>([plainJsonPtr](float topRate) {
+            (*plainJsonPtr)["goss_top_rate"] = topRate;
+        })
+        .Help("Fraction of objects with the largest gradients always kept by GOSS bootstrap; "
+            "subsample controls the sample rate for the rest. Possible values are from [0, 1); 0.2 by default."
+        );
+
     parser
         .AddLongOption("observations-to-bootstrap")
         .RequiredArgument("FLAG")
@@ -1198,6 +1226,30 @@ static void BindDistributedTrainingParams(NLastGetopt::TOpts* parserPtr, NJson::
         .Handler1T<TString>([plainJsonPtr](const TString& nodeFile) {
             (*plainJsonPtr)["file_with_hosts"] = nodeFile;
         });
+
+    parser
+        .AddLongOption("compact-distributed-stats")
+        .NoArgument()
+        .Help("Send bucket statistics between hosts as floats skipping empty buckets")
+        .Handler0([plainJsonPtr]() {
+            (*plainJsonPtr)["compact_distributed_stats"] = true;
+        });
+
+    parser
+        .AddLongOption("voting-candidate-count")
+        .RequiredArgument("int")
+        .Help("Number of split candidates each worker votes for; only voted candidates get their statistics aggregated. Default is 0 (no voting)")
+        .Handler1T<ui32>([plainJsonPtr](ui32 count) {
+            (*plainJsonPtr)["voting_candidate_count"] = count;
+        });
+
+    parser
+        .AddLongOption("skip-unavailable-workers")
+        .NoArgument()
+        .Help("At startup, skip workers from file-with-hosts that do not accept connections. Workers lost during training are not replaced")
+        .Handler0([plainJsonPtr]() {
+            (*plainJsonPtr)["skip_unavailable_workers"] = true;
+        });
 }
 
 static void BindSystemParams(NLastGetopt::TOpts* parserPtr, NJson::TJsonValue* plainJsonPtr) {
@@ -1238,6 +1290,14 @@ static void BindSystemParams(NLastGetopt::TOpts* parserPtr, NJson::TJsonValue* p
             .Handler1T<TString>([plainJsonPtr](const TString& param) {
                 (*plainJsonPtr)["pinned_memory_size"] = param;
             });
+
+    parser
+        .AddLongOption("pin-threads")
+        .NoArgument()
+        .Help("CPU only. Pin worker threads to CPUs spread over all NUMA nodes. Linux only.")
+        .Handler0([plainJsonPtr]() {
+            (*plainJsonPtr)["pin_threads"] = true;
+        });
 }
 
 static void BindBinarizationParams(NLastGetopt::TOpts* parserPtr, NJson::TJsonValue* plainJsonPtr) {
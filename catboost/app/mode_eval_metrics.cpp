@@ -14,6 +14,7 @@
 
 #include <library/cpp/getopt/small/last_getopt_opts.h>
 #include <library/cpp/getopt/small/last_getopt_parse_result.h>
+#include <library/cpp/threading/future/future.h>
 
 #include <util/folder/tempdir.h>
 #include <util/string/split.h>
@@ -163,6 +164,18 @@ int mode_eval_metrics(int argc, const char* argv[]) {
 
     TVector<TProcessedDataProvider> datasetParts;
     if (plotCalcer.HasAdditiveMetric()) {
+        // Metrics of the previous block are calculated on a separate thread
+        // while the current block is being read and processed
+        NPar::TLocalExecutor metricsExecutor;
+        metricsExecutor.RunAdditionalThreads(1);
+        NThreading::TFuture<void> metricsFuture;
+        auto waitForMetrics = [&metricsFuture] () {
+            if (metricsFuture.Initialized()) {
+                metricsFuture.GetValueSync(); // will rethrow if there was an exception during calculation
+                metricsFuture = NThreading::TFuture<void>();
+            }
+        };
+
         ReadAndProceedPoolInBlocks(
             params.DatasetReadingParams,
             plotParams.ReadBlockSize,
@@ -175,12 +188,24 @@ int mode_eval_metrics(int argc, const char* argv[]) {
                     &rand,
                     &executor);
 
-                plotCalcer.ProceedDataSetForAdditiveMetrics(processedDataProvider);
+                waitForMetrics();
+                auto metricsFutures = metricsExecutor.ExecRangeWithFutures(
+                    [&plotCalcer, processedDataProvider] (int) {
+                        plotCalcer.ProceedDataSetForAdditiveMetrics(processedDataProvider);
+                    },
+                    0,
+                    1,
+                    NPar::TLocalExecutor::HIGH_PRIORITY
+                );
+                Y_VERIFY(metricsFutures.size() == 1);
+                metricsFuture = std::move(metricsFutures[0]);
+
                 if (plotCalcer.HasNonAdditiveMetric() && !calcOnParts) {
                     datasetParts.push_back(std::move(processedDataProvider));
                 }
             },
             &executor);
+        waitForMetrics();
     }
 
     if (plotCalcer.HasNonAdditiveMetric() && calcOnParts) {
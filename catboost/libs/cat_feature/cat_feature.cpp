@@ -2,7 +2,16 @@
 
 #include <util/digest/city.h>
 #include <util/generic/strbuf.h>
+#include <util/system/yassert.h>
 
 ui32 CalcCatFeatureHash(const TStringBuf feature) noexcept {
     return CityHash64(feature) & 0xffffffff;
 }
+
+void CalcCatFeatureHashes(TConstArrayRef<TStringBuf> features, TArrayRef<ui32> hashes) noexcept {
+    Y_ASSERT(features.size() == hashes.size());
+    TCatFeatureHashCache hashCache;
+    for (size_t i = 0; i < features.size(); ++i) {
+        hashes[i] = hashCache(features[i]);
+    }
+}
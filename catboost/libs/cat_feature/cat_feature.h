@@ -1,10 +1,48 @@
 #pragma once
 
+#include <util/generic/array_ref.h>
 #include <util/generic/strbuf.h>
 #include <util/system/types.h>
 
+#include <array>
+
 ui32 CalcCatFeatureHash(const TStringBuf feature) noexcept;
 
+/**
+ * Calculates CalcCatFeatureHash for a stream of values and reuses hashes of values that repeat the previous one
+ * or are stored at the address of a recently hashed one, which is typical for categorical columns.
+ * Values are cached as views, so their data must stay unchanged while the cache is used:
+ * keep the cache local to one pass over the features.
+ */
+class TCatFeatureHashCache {
+public:
+    ui32 operator()(const TStringBuf feature) noexcept {
+        TEntry& entry = Entries[(reinterpret_cast<size_t>(feature.data()) >> 4) % Entries.size()];
+        if (!entry.Filled || entry.Value.data() != feature.data() || entry.Value.size() != feature.size()) {
+            const ui32 hash = (LastEntry.Filled && LastEntry.Value == feature) ? LastEntry.Hash : CalcCatFeatureHash(feature);
+            entry.Value = feature;
+            entry.Hash = hash;
+            entry.Filled = true;
+        }
+        LastEntry = entry;
+        return entry.Hash;
+    }
+
+private:
+    struct TEntry {
+        TStringBuf Value;
+        ui32 Hash = 0;
+        bool Filled = false;
+    };
+
+private:
+    std::array<TEntry, 64> Entries;
+    TEntry LastEntry;
+};
+
+// hashes.size() should be equal to features.size()
+void CalcCatFeatureHashes(TConstArrayRef<TStringBuf> features, TArrayRef<ui32> hashes) noexcept;
+
 // deprecated, for compatibility, prefer CalcCatFeatureHash in new code
 inline int CalcCatFeatureHashInt(const TStringBuf feature) noexcept {
     ui32 hashVal = CalcCatFeatureHash(feature);
@@ -21,6 +21,27 @@
 using namespace NCB;
 
 
+TShapLeafTable::TShapLeafTable(const TVector<TVector<TShapValue>>& shapValuesByLeaf, int approxDimension) {
+    size_t entryCount = 0;
+    for (const auto& leafShapValues : shapValuesByLeaf) {
+        entryCount += leafShapValues.size();
+    }
+    LeafOffsets.yresize(shapValuesByLeaf.size() + 1);
+    Features.yresize(entryCount);
+    Values.yresize(entryCount * approxDimension);
+    size_t entryIdx = 0;
+    for (size_t leafIdx : xrange(shapValuesByLeaf.size())) {
+        LeafOffsets[leafIdx] = SafeIntegerCast<ui32>(entryIdx);
+        for (const TShapValue& shapValue : shapValuesByLeaf[leafIdx]) {
+            Y_ASSERT(shapValue.Value.ysize() == approxDimension);
+            Features[entryIdx] = shapValue.Feature;
+            Copy(shapValue.Value.begin(), shapValue.Value.end(), Values.begin() + entryIdx * approxDimension);
+            ++entryIdx;
+        }
+    }
+    LeafOffsets.back() = SafeIntegerCast<ui32>(entryIdx);
+}
+
 static TVector<double> CalcMeanValueForTree(
     const TModelTrees& forest,
     const TVector<TVector<double>>& subtreeWeights,
@@ -423,7 +444,7 @@ static void InitPreparedTrees(
             = modelLeafWeights.empty() ? leafWeights : modelLeafWeights;
     }
 
-    preparedTrees->ShapValuesByLeafForAllTrees.resize(treeCount);
+    preparedTrees->ShapLeafTablesForAllTrees.resize(treeCount);
     preparedTrees->SubtreeWeightsForAllTrees.resize(treeCount);
     preparedTrees->MeanValuesForAllTrees.resize(treeCount);
     if (calcType == ECalcTypeShapValues::Approximate) {
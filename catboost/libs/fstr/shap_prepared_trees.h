@@ -28,6 +28,25 @@ public:
     Y_SAVELOAD_DEFINE(Feature, Value);
 };
 
+// Flattened per-leaf shap contributions of one oblivious tree.
+// Calculating shap values of a document for the tree is then a gather-add by its leaf index.
+struct TShapLeafTable {
+    TVector<ui32> LeafOffsets; // [leafIdx] -> first entry of the leaf, size is leafCount + 1
+    TVector<int> Features; // [entryIdx]
+    TVector<double> Values; // [entryIdx * approxDimension + dimension]
+
+public:
+    TShapLeafTable() = default;
+
+    TShapLeafTable(const TVector<TVector<TShapValue>>& shapValuesByLeaf, int approxDimension);
+
+    bool Empty() const {
+        return LeafOffsets.empty();
+    }
+
+    Y_SAVELOAD_DEFINE(LeafOffsets, Features, Values);
+};
+
 struct TIndependentTreeShapParams {
     TVector<TVector<double>> ProbabilitiesOfReferenceDataset; // [dim][documentIdx]
     TVector<TVector<double>> TransformedTargetOfDataset; // [dim][documentIdx]
@@ -63,7 +82,7 @@ private:
 };
 
 struct TShapPreparedTrees {
-    TVector<TVector<TVector<TShapValue>>> ShapValuesByLeafForAllTrees; // [treeIdx][leafIdx][shapFeature] trees * 2^d * d
+    TVector<TShapLeafTable> ShapLeafTablesForAllTrees; // [treeIdx], filled only for oblivious trees with precalc
     TVector<TVector<double>> MeanValuesForAllTrees;
     TVector<double> AverageApproxByTree;
     TVector<int> BinFeatureCombinationClass;
@@ -82,13 +101,20 @@ public:
         const TVector<TVector<TVector<TShapValue>>>& shapValuesByLeafForAllTrees,
         const TVector<TVector<double>>& meanValuesForAllTrees
     )
-        : ShapValuesByLeafForAllTrees(shapValuesByLeafForAllTrees)
-        , MeanValuesForAllTrees(meanValuesForAllTrees)
+        : MeanValuesForAllTrees(meanValuesForAllTrees)
     {
+        Y_ASSERT(shapValuesByLeafForAllTrees.size() == meanValuesForAllTrees.size());
+        ShapLeafTablesForAllTrees.reserve(shapValuesByLeafForAllTrees.size());
+        for (size_t treeIdx = 0; treeIdx < shapValuesByLeafForAllTrees.size(); ++treeIdx) {
+            ShapLeafTablesForAllTrees.emplace_back(
+                shapValuesByLeafForAllTrees[treeIdx],
+                meanValuesForAllTrees[treeIdx].ysize()
+            );
+        }
     }
 
     Y_SAVELOAD_DEFINE(	
-        ShapValuesByLeafForAllTrees,	
+        ShapLeafTablesForAllTrees,	
         MeanValuesForAllTrees,	
         AverageApproxByTree,	
         BinFeatureCombinationClass,	
@@ -856,6 +856,29 @@ static inline void AddValuesToShapValues(
     }
 }
 
+static inline void AddValuesToShapValues(
+    const TShapLeafTable& shapLeafTable,
+    NModelEvaluation::TCalcerIndexType leafIdx,
+    int approxDimension,
+    TVector<TVector<double>>* shapValues
+) {
+    const ui32 entryEnd = shapLeafTable.LeafOffsets[leafIdx + 1];
+    const double* values = shapLeafTable.Values.data() + shapLeafTable.LeafOffsets[leafIdx] * approxDimension;
+    if (approxDimension == 1) {
+        double* shapValuesData = (*shapValues)[0].data();
+        for (ui32 entryIdx = shapLeafTable.LeafOffsets[leafIdx]; entryIdx < entryEnd; ++entryIdx, ++values) {
+            shapValuesData[shapLeafTable.Features[entryIdx]] += *values;
+        }
+        return;
+    }
+    for (ui32 entryIdx = shapLeafTable.LeafOffsets[leafIdx]; entryIdx < entryEnd; ++entryIdx) {
+        const int feature = shapLeafTable.Features[entryIdx];
+        for (int dimension : xrange(approxDimension)) {
+            (*shapValues)[dimension][feature] += *values++;
+        }
+    }
+}
+
 void CalcShapValuesForDocumentMulti(
     const TFullModel& model,
     const TShapPreparedTrees& preparedTrees,
@@ -898,9 +921,10 @@ void CalcShapValuesForDocumentMulti(
                     &shapValuesForAllReferences
                 );
             } else {
-                Y_ASSERT(docIndices[treeIdx] < preparedTrees.ShapValuesByLeafForAllTrees[treeIdx].size());
+                Y_ASSERT(docIndices[treeIdx] + 1 < preparedTrees.ShapLeafTablesForAllTrees[treeIdx].LeafOffsets.size());
                 AddValuesToShapValues(
-                    preparedTrees.ShapValuesByLeafForAllTrees[treeIdx][docIndices[treeIdx]],
+                    preparedTrees.ShapLeafTablesForAllTrees[treeIdx],
+                    docIndices[treeIdx],
                     approxDimension,
                     shapValues
                 );
@@ -1135,8 +1159,7 @@ static void CalcShapValuesByLeafForTreeBlock(
     localExecutor->ExecRange([&] (size_t treeIdx) {
         if (preparedTrees->CalcShapValuesByLeafForAllTrees && isOblivious) {
             const size_t leafCount = (size_t(1) << forest.GetModelTreeData()->GetTreeSizes()[treeIdx]);
-            TVector<TVector<TShapValue>>& shapValuesByLeaf = preparedTrees->ShapValuesByLeafForAllTrees[treeIdx];
-            shapValuesByLeaf.resize(leafCount);
+            TVector<TVector<TShapValue>> shapValuesByLeaf(leafCount);
             for (size_t leafIdx = 0; leafIdx < leafCount; ++leafIdx) {
                 switch (calcType) {
                     case ECalcTypeShapValues::Approximate:
@@ -1197,6 +1220,7 @@ static void CalcShapValuesByLeafForTreeBlock(
                     }
                 }
             }
+            preparedTrees->ShapLeafTablesForAllTrees[treeIdx] = TShapLeafTable(shapValuesByLeaf, forest.GetDimensionsCount());
         }
     }, blockParams, NPar::TLocalExecutor::WAIT_COMPLETE);
 }
@@ -1279,9 +1303,14 @@ void CalcShapValuesInternalForFeature(
             auto docIndices = MakeArrayRef(indices.data() + forest.GetTreeCount() * (documentIdx - startIdx), forest.GetTreeCount());
             for (size_t treeIdx = 0; treeIdx < forest.GetTreeCount(); ++treeIdx) {
                 if (preparedTrees.CalcShapValuesByLeafForAllTrees && model.IsOblivious()) {
-                    for (const TShapValue& shapValue : preparedTrees.ShapValuesByLeafForAllTrees[treeIdx][docIndices[treeIdx]]) {
-                        for (int dimension = 0; dimension < (int)forest.GetDimensionsCount(); ++dimension) {
-                            docShapValues[shapValue.Feature][dimension] += shapValue.Value[dimension];
+                    const TShapLeafTable& shapLeafTable = preparedTrees.ShapLeafTablesForAllTrees[treeIdx];
+                    const ui32 leafIdx = docIndices[treeIdx];
+                    const int approxDimension = forest.GetDimensionsCount();
+                    const double* values = shapLeafTable.Values.data() + shapLeafTable.LeafOffsets[leafIdx] * approxDimension;
+                    for (ui32 entryIdx = shapLeafTable.LeafOffsets[leafIdx]; entryIdx < shapLeafTable.LeafOffsets[leafIdx + 1]; ++entryIdx) {
+                        auto& featureShapValues = docShapValues[shapLeafTable.Features[entryIdx]];
+                        for (int dimension = 0; dimension < approxDimension; ++dimension) {
+                            featureShapValues[dimension] += *values++;
                         }
                     }
                 } else {
@@ -0,0 +1,90 @@
+#include "thread_affinity.h"
+
+#include <catboost/libs/logging/logging.h>
+
+#include <library/cpp/threading/local_executor/local_executor.h>
+
+#include <util/generic/vector.h>
+#include <util/system/atomic.h>
+#include <util/system/error.h>
+#include <util/system/platform.h>
+#include <util/system/yield.h>
+
+#if defined(_linux_)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace NCB {
+
+#if defined(_linux_)
+
+    static TVector<int> GetAllowedCpus() {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        TVector<int> cpus;
+        if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+            CATBOOST_WARNING_LOG << "Can't get CPU affinity of the current thread: " << LastSystemErrorText() << Endl;
+            return cpus;
+        }
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &cpuSet)) {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+
+    void PinLocalExecutorThreadsToCpus(NPar::TLocalExecutor* localExecutor) {
+        const int workerCount = localExecutor->GetThreadCount();
+        if (workerCount == 0) {
+            return;
+        }
+        const TVector<int> cpus = GetAllowedCpus();
+        if (cpus.empty()) {
+            return;
+        }
+
+        // each job waits until all jobs have started, so every worker thread gets exactly one job
+        TAtomic startedCount = 0;
+        TAtomic failedCount = 0;
+        auto futures = localExecutor->ExecRangeWithFutures(
+            [&] (int /*jobIdx*/) {
+                const int workerIdx = AtomicIncrement(startedCount) - 1;
+                while (AtomicGet(startedCount) < workerCount) {
+                    ThreadYield();
+                }
+                // spread workers evenly over the allowed CPUs (and thus over NUMA nodes)
+                const int cpu = cpus[(size_t(workerIdx) * cpus.size() / workerCount) % cpus.size()];
+                cpu_set_t cpuSet;
+                CPU_ZERO(&cpuSet);
+                CPU_SET(cpu, &cpuSet);
+                if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0) {
+                    AtomicIncrement(failedCount);
+                }
+            },
+            0,
+            workerCount,
+            NPar::TLocalExecutor::HIGH_PRIORITY
+        );
+        for (auto& future : futures) {
+            future.GetValueSync();
+        }
+        if (AtomicGet(failedCount)) {
+            CATBOOST_WARNING_LOG << "Failed to pin " << AtomicGet(failedCount) << " of " << workerCount
+                << " threads to CPUs" << Endl;
+        } else {
+            CATBOOST_DEBUG_LOG << "Pinned " << workerCount << " threads to " << cpus.size() << " CPUs" << Endl;
+        }
+    }
+
+#else
+
+    void PinLocalExecutorThreadsToCpus(NPar::TLocalExecutor* /*localExecutor*/) {
+        CATBOOST_WARNING_LOG << "Pinning threads to CPUs is supported only on Linux" << Endl;
+    }
+
+#endif
+
+}
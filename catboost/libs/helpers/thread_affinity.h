@@ -0,0 +1,19 @@
+#pragma once
+
+namespace NPar {
+    class TLocalExecutor;
+}
+
+
+namespace NCB {
+
+    /* Pin each worker thread of localExecutor to its own CPU from the set allowed for the calling thread.
+     * Threads are spread evenly over the allowed CPUs, so on multi-socket hosts they are distributed
+     * over all sockets and do not migrate between them. Memory placement is not controlled: work is
+     * not statically assigned to threads, so data is not guaranteed to be local to the thread using it.
+     * The calling thread itself is not pinned.
+     * Supported only on Linux, does nothing (with a warning) on other platforms.
+     */
+    void PinLocalExecutorThreadsToCpus(NPar::TLocalExecutor* localExecutor);
+
+}
@@ -34,6 +34,31 @@ namespace NCB::NModelEvaluation {
         size_t docCountInBlock,
         bool calcIndexesOnly = false);
 
+    /**
+     * Scratch memory for block-wise model evaluation. Buffers are never shrunk, so after the first call
+     * for a given model and block size the evaluation does not touch the heap.
+     * Object is not thread safe: use one instance per thread (see GetThreadLocalScratchBuffers).
+     */
+    struct TCPUEvaluatorScratchBuffers {
+        TVector<ui8> QuantizedData;
+        TVector<ui32> TransposedHash;
+        TVector<float> Ctrs;
+        TVector<float> EstimatedFeatures;
+        TVector<TCalcerIndexType> Indexes;
+        TVector<double> IntermediateBlockResults;
+        TVector<ui8> CompactedQuantizedData;
+
+        template <typename T>
+        static TArrayRef<T> GetBuffer(TVector<T>* holder, size_t size) {
+            if (holder->size() < size) {
+                holder->yresize(size);
+            }
+            return MakeArrayRef(holder->data(), size);
+        }
+    };
+
+    TCPUEvaluatorScratchBuffers& GetThreadLocalScratchBuffers();
+
     template <class X>
     inline X* GetAligned(X* val) {
         uintptr_t off = ((uintptr_t)val) & 0xf;
@@ -54,7 +79,9 @@ namespace NCB::NModelEvaluation {
         size_t docCount,
         size_t blockSize,
         TFunctor callback,
-        const NCB::NModelEvaluation::TFeatureLayout* featureInfo
+        const NCB::NModelEvaluation::TFeatureLayout* featureInfo,
+        TCPUEvaluatorScratchBuffers* scratchBuffers = nullptr,
+        const TFeaturesToBinarize* featuresToBinarize = nullptr
     ) {
         ProcessDocsInBlocks(
             trees,
@@ -72,7 +99,9 @@ namespace NCB::NModelEvaluation {
             docCount,
             blockSize,
             callback,
-            featureInfo
+            featureInfo,
+            scratchBuffers,
+            featuresToBinarize
         );
     }
 
@@ -92,12 +121,17 @@ namespace NCB::NModelEvaluation {
         size_t docCount,
         size_t blockSize,
         TFunctor callback,
-        const NCB::NModelEvaluation::TFeatureLayout* featureInfo
+        const NCB::NModelEvaluation::TFeatureLayout* featureInfo,
+        TCPUEvaluatorScratchBuffers* scratchBuffers = nullptr,
+        const TFeaturesToBinarize* featuresToBinarize = nullptr
     ) {
         const size_t binSlots = blockSize * trees.GetEffectiveBinaryFeaturesBucketsCount();
 
         TCPUEvaluatorQuantizedData quantizedData;
-        if (binSlots < 65536) { // 65KB of stack maximum
+        if (scratchBuffers) {
+            quantizedData.QuantizedData = NCB::TMaybeOwningArrayHolder<ui8>::CreateNonOwning(
+                TCPUEvaluatorScratchBuffers::GetBuffer(&scratchBuffers->QuantizedData, binSlots));
+        } else if (binSlots < 65536) { // 65KB of stack maximum
             quantizedData.QuantizedData = NCB::TMaybeOwningArrayHolder<ui8>::CreateNonOwning(
                 MakeArrayRef(GetAligned((ui8*)(alloca(binSlots + 0x20))), binSlots));
         } else {
@@ -106,12 +140,22 @@ namespace NCB::NModelEvaluation {
             quantizedData.QuantizedData = NCB::TMaybeOwningArrayHolder<ui8>::CreateOwning(std::move(binFeaturesHolder));
         }
 
-        TVector<ui32> transposedHash(blockSize * trees.GetUsedCatFeaturesCount());
-        TVector<float> ctrs(trees.GetUsedModelCtrs().size() * blockSize);
-        TVector<float> estimatedFeatures;
+        TCPUEvaluatorScratchBuffers localBuffers;
+        if (!scratchBuffers) {
+            scratchBuffers = &localBuffers;
+        }
+        auto transposedHash = TCPUEvaluatorScratchBuffers::GetBuffer(
+            &scratchBuffers->TransposedHash,
+            blockSize * trees.GetUsedCatFeaturesCount());
+        auto ctrs = TCPUEvaluatorScratchBuffers::GetBuffer(
+            &scratchBuffers->Ctrs,
+            trees.GetUsedModelCtrs().size() * blockSize);
+        TArrayRef<float> estimatedFeatures;
         if (textProcessingCollection) {
             // TODO(d-kruchinin): replace to GetUsedEstimatedFeatures.size() after creation TrimFeatures
-            estimatedFeatures = TVector<float>(textProcessingCollection->TotalNumberOfOutputFeatures() * blockSize);
+            estimatedFeatures = TCPUEvaluatorScratchBuffers::GetBuffer(
+                &scratchBuffers->EstimatedFeatures,
+                textProcessingCollection->TotalNumberOfOutputFeatures() * blockSize);
         }
 
         for (size_t blockStart = 0; blockStart < docCount; blockStart += blockSize) {
@@ -129,7 +173,8 @@ namespace NCB::NModelEvaluation {
                 transposedHash,
                 ctrs,
                 estimatedFeatures,
-                featureInfo
+                featureInfo,
+                featuresToBinarize
             );
             callback(docCountInBlock, &quantizedData);
         }
@@ -161,6 +206,7 @@ namespace NCB::NModelEvaluation {
         size_t docCount,
         size_t treeStart,
         size_t treeEnd,
+        TFeaturesToBinarizeCache* featuresToBinarizeCache,
         TArrayRef<TCalcerIndexType> treeLeafIndexes,
         const NCB::NModelEvaluation::TFeatureLayout* featureInfo
     ) {
@@ -179,7 +225,9 @@ namespace NCB::NModelEvaluation {
         TCalcerIndexType* indexesWritePtr = treeLeafIndexes.data();
 
         auto calcTrees = GetCalcTreesFunction(trees, blockSize, true);
+        const auto featuresToBinarize = featuresToBinarizeCache->Get(trees, treeStart, treeEnd);
 
+        auto& scratchBuffers = GetThreadLocalScratchBuffers();
         if (docCount == 1) {
             ProcessDocsInBlocks(
                 trees, ctrProvider, floatFeatureAccessor, catFeaturesAccessor, docCount, blockSize,
@@ -194,12 +242,15 @@ namespace NCB::NModelEvaluation {
                         nullptr
                     );
                 },
-                featureInfo
+                featureInfo,
+                &scratchBuffers,
+                featuresToBinarize.Get()
             );
             return;
         }
-        TVector<TCalcerIndexType> tmpLeafIndexHolder(blockSize * treeCount);
-        TCalcerIndexType* transposedLeafIndexesPtr = tmpLeafIndexHolder.data();
+        TCalcerIndexType* transposedLeafIndexesPtr = TCPUEvaluatorScratchBuffers::GetBuffer(
+            &scratchBuffers.Indexes,
+            blockSize * treeCount).data();
         ProcessDocsInBlocks(
             trees,
             ctrProvider,
@@ -226,7 +277,9 @@ namespace NCB::NModelEvaluation {
                 );
                 indexesWritePtr += indexCountInBlock;
             },
-            featureInfo
+            featureInfo,
+            &scratchBuffers,
+            featuresToBinarize.Get()
         );
     }
 }
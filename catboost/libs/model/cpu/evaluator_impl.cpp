@@ -776,6 +776,11 @@ namespace NCB::NModelEvaluation {
         }
     };
 
+    TCPUEvaluatorScratchBuffers& GetThreadLocalScratchBuffers() {
+        static thread_local TCPUEvaluatorScratchBuffers scratchBuffers;
+        return scratchBuffers;
+    }
+
     TTreeCalcFunction GetCalcTreesFunction(
         const TModelTrees& trees,
         size_t docCountInBlock,
@@ -16,6 +16,7 @@ namespace NCB::NModelEvaluation {
             size_t docCount,
             size_t treeStart,
             size_t treeEnd,
+            TFeaturesToBinarizeCache* featuresToBinarizeCache,
             EPredictionType predictionType,
             TArrayRef<double> results,
             const NCB::NModelEvaluation::TFeatureLayout* featureInfo = nullptr
@@ -36,14 +37,18 @@ namespace NCB::NModelEvaluation {
                 return;
             }
             Fill(results.begin(), results.end(), 0.0);
-            TVector<TCalcerIndexType> indexesVec(blockSize);
+            const auto featuresToBinarize = featuresToBinarizeCache->Get(trees, treeStart, treeEnd);
+            auto& scratchBuffers = GetThreadLocalScratchBuffers();
+            auto indexesVec = TCPUEvaluatorScratchBuffers::GetBuffer(&scratchBuffers.Indexes, blockSize);
             TEvalResultProcessor resultProcessor(
                 docCount,
                 results,
                 predictionType,
                 trees.GetScaleAndBias(),
                 trees.GetDimensionsCount(),
-                blockSize
+                blockSize,
+                Nothing(),
+                &scratchBuffers.IntermediateBlockResults
             );
             ui32 blockId = 0;
             ProcessDocsInBlocks(
@@ -69,7 +74,121 @@ namespace NCB::NModelEvaluation {
                     resultProcessor.PostprocessBlock(blockId, treeStart);
                     ++blockId;
                 },
-                featureInfo
+                featureInfo,
+                &scratchBuffers,
+                featuresToBinarize.Get()
+            );
+        }
+
+        template <typename TFloatFeatureAccessor, typename TCatFeatureAccessor>
+        inline void CalcCascadedGeneric(
+            const TModelTrees& trees,
+            const TIntrusivePtr<ICtrProvider>& ctrProvider,
+            TFloatFeatureAccessor floatFeatureAccessor,
+            TCatFeatureAccessor catFeaturesAccessor,
+            size_t docCount,
+            TConstArrayRef<TCascadeCheckpoint> checkpoints,
+            TArrayRef<double> results,
+            TArrayRef<ui32> evaluatedTreeCounts,
+            const NCB::NModelEvaluation::TFeatureLayout* featureInfo
+        ) {
+            if (docCount == 0) {
+                return;
+            }
+            const size_t treeCount = trees.GetTreeCount();
+            const size_t bucketCount = trees.GetEffectiveBinaryFeaturesBucketsCount();
+            const double scale = trees.GetScaleAndBias().Scale;
+            const double bias = trees.GetScaleAndBias().GetOneDimensionalBias();
+            const size_t blockSize = Min(FORMULA_EVALUATION_BLOCK_SIZE, docCount);
+            // the only thing calc function choice depends on is whether the block has a single object
+            auto calcTreesSingle = GetCalcTreesFunction(trees, 1);
+            auto calcTreesBlocked = GetCalcTreesFunction(trees, FORMULA_EVALUATION_BLOCK_SIZE);
+
+            auto& scratchBuffers = GetThreadLocalScratchBuffers();
+            auto indexesVec = TCPUEvaluatorScratchBuffers::GetBuffer(&scratchBuffers.Indexes, blockSize);
+            auto compactedBins = TCPUEvaluatorScratchBuffers::GetBuffer(
+                &scratchBuffers.CompactedQuantizedData,
+                blockSize * bucketCount);
+            TCPUEvaluatorQuantizedData compactedData;
+            compactedData.QuantizedData = TMaybeOwningArrayHolder<ui8>::CreateNonOwning(compactedBins);
+
+            size_t blockStart = 0;
+            ProcessDocsInBlocks(
+                trees,
+                ctrProvider,
+                floatFeatureAccessor,
+                catFeaturesAccessor,
+                docCount,
+                blockSize,
+                [&] (size_t docCountInBlock, const TCPUEvaluatorQuantizedData* quantizedData) {
+                    // active objects are kept in the first activeCount positions of bins and partial sums
+                    ui32 activeDocs[FORMULA_EVALUATION_BLOCK_SIZE];
+                    ui32 keptPositions[FORMULA_EVALUATION_BLOCK_SIZE];
+                    double partialSums[FORMULA_EVALUATION_BLOCK_SIZE];
+                    double stageSums[FORMULA_EVALUATION_BLOCK_SIZE];
+                    Iota(activeDocs, activeDocs + docCountInBlock, 0);
+                    Fill(partialSums, partialSums + docCountInBlock, 0.0);
+
+                    const TCPUEvaluatorQuantizedData* activeData = quantizedData;
+                    size_t activeCount = docCountInBlock;
+                    size_t stageStart = 0;
+                    for (size_t stageId = 0; stageId <= checkpoints.size() && activeCount != 0; ++stageId) {
+                        const bool isLastStage = (stageId == checkpoints.size());
+                        const size_t stageEnd = isLastStage ? treeCount : checkpoints[stageId].TreeEnd;
+                        if (stageStart < stageEnd) {
+                            Fill(stageSums, stageSums + activeCount, 0.0);
+                            (activeCount == 1 ? calcTreesSingle : calcTreesBlocked)(
+                                trees,
+                                activeData,
+                                activeCount,
+                                indexesVec.data(),
+                                stageStart,
+                                stageEnd,
+                                stageSums
+                            );
+                            for (size_t i = 0; i < activeCount; ++i) {
+                                partialSums[i] += stageSums[i];
+                            }
+                        }
+                        stageStart = stageEnd;
+
+                        size_t keptCount = 0;
+                        for (size_t i = 0; i < activeCount; ++i) {
+                            const double value = scale * partialSums[i] + bias;
+                            if (isLastStage
+                                || value <= checkpoints[stageId].LowerThreshold
+                                || value >= checkpoints[stageId].UpperThreshold)
+                            {
+                                const size_t docId = blockStart + activeDocs[i];
+                                results[docId] = value;
+                                if (!evaluatedTreeCounts.empty()) {
+                                    evaluatedTreeCounts[docId] = stageEnd;
+                                }
+                            } else {
+                                keptPositions[keptCount] = i;
+                                activeDocs[keptCount] = activeDocs[i];
+                                partialSums[keptCount] = partialSums[i];
+                                ++keptCount;
+                            }
+                        }
+                        if (keptCount != 0 && keptCount != activeCount) {
+                            // bins layout is [bucket][object], positions only move backwards so compaction
+                            // can be done in place once data is in the compacted buffer
+                            const ui8* src = activeData->QuantizedData.data();
+                            ui8* dst = compactedBins.data();
+                            for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                                for (size_t i = 0; i < keptCount; ++i) {
+                                    dst[bucket * keptCount + i] = src[bucket * activeCount + keptPositions[i]];
+                                }
+                            }
+                            activeData = &compactedData;
+                        }
+                        activeCount = keptCount;
+                    }
+                    blockStart += docCountInBlock;
+                },
+                featureInfo,
+                &scratchBuffers
             );
         }
 
@@ -79,6 +198,7 @@ namespace NCB::NModelEvaluation {
                 : ModelTrees(fullModel.ModelTrees)
                 , CtrProvider(fullModel.CtrProvider)
                 , TextProcessingCollection(fullModel.TextProcessingCollection)
+                , FeaturesToBinarizeCache(MakeAtomicShared<TFeaturesToBinarizeCache>())
             {}
 
             void SetPredictionType(EPredictionType type) override {
@@ -166,6 +286,7 @@ namespace NCB::NModelEvaluation {
                     *docCount,
                     treeStart,
                     treeEnd,
+                    FeaturesToBinarizeCache.Get(),
                     PredictionType,
                     results,
                     featureInfo
@@ -210,6 +331,7 @@ namespace NCB::NModelEvaluation {
                     features.size(),
                     treeStart,
                     treeEnd,
+                    FeaturesToBinarizeCache.Get(),
                     PredictionType,
                     results,
                     featureInfo
@@ -244,6 +366,7 @@ namespace NCB::NModelEvaluation {
                     1,
                     treeStart,
                     treeEnd,
+                    FeaturesToBinarizeCache.Get(),
                     PredictionType,
                     results,
                     featureInfo
@@ -303,6 +426,7 @@ namespace NCB::NModelEvaluation {
                     docCount,
                     treeStart,
                     treeEnd,
+                    FeaturesToBinarizeCache.Get(),
                     PredictionType,
                     results,
                     featureInfo
@@ -346,6 +470,7 @@ namespace NCB::NModelEvaluation {
                 }
                 ValidateInputFeatures(floatFeatures, catFeatures, textFeatures, featureInfo);
                 const size_t docCount = Max(catFeatures.size(), floatFeatures.size(), textFeatures.size());
+                TCatFeatureHashCache catFeatureHashCache;
                 CalcGeneric(
                     *ModelTrees,
                     CtrProvider,
@@ -353,8 +478,8 @@ namespace NCB::NModelEvaluation {
                     [&floatFeatures](TFeaturePosition position, size_t index) -> float {
                         return floatFeatures[index][position.Index];
                     },
-                    [&catFeatures](TFeaturePosition position, size_t index) -> int {
-                        return CalcCatFeatureHash(catFeatures[index][position.Index]);
+                    [&catFeatures, &catFeatureHashCache](TFeaturePosition position, size_t index) -> int {
+                        return catFeatureHashCache(catFeatures[index][position.Index]);
                     },
                     [&textFeatures](TFeaturePosition position, size_t index) -> TStringBuf {
                         return textFeatures[index][position.Index];
@@ -362,6 +487,7 @@ namespace NCB::NModelEvaluation {
                     docCount,
                     treeStart,
                     treeEnd,
+                    FeaturesToBinarizeCache.Get(),
                     PredictionType,
                     results,
                     featureInfo
@@ -392,6 +518,7 @@ namespace NCB::NModelEvaluation {
                     1,
                     treeStart,
                     treeEnd,
+                    FeaturesToBinarizeCache.Get(),
                     indexes,
                     featureInfo
                 );
@@ -411,18 +538,20 @@ namespace NCB::NModelEvaluation {
                 ValidateInputFeatures(floatFeatures, catFeatures, {}, featureInfo);
                 const size_t docCount = Max(catFeatures.size(), floatFeatures.size());
                 CB_ENSURE(docCount * (treeEnd - treeStart) == indexes.size(), LabeledOutput(docCount * (treeEnd - treeStart), indexes.size()));
+                TCatFeatureHashCache catFeatureHashCache;
                 CalcLeafIndexesGeneric(
                     *ModelTrees,
                     CtrProvider,
                     [&floatFeatures](TFeaturePosition position, size_t index) -> float {
                         return floatFeatures[index][position.Index];
                     },
-                    [&catFeatures](TFeaturePosition position, size_t index) -> int {
-                        return CalcCatFeatureHash(catFeatures[index][position.Index]);
+                    [&catFeatures, &catFeatureHashCache](TFeaturePosition position, size_t index) -> int {
+                        return catFeatureHashCache(catFeatures[index][position.Index]);
                     },
                     docCount,
                     treeStart,
                     treeEnd,
+                    FeaturesToBinarizeCache.Get(),
                     indexes,
                     featureInfo
                 );
@@ -451,7 +580,9 @@ namespace NCB::NModelEvaluation {
                     false
                 );
                 CB_ENSURE(results.size() == ModelTrees->GetDimensionsCount() * cpuQuantizedFeatures->ObjectsCount);
-                TVector<TCalcerIndexType> indexesVec(subBlockSize);
+                auto indexesVec = TCPUEvaluatorScratchBuffers::GetBuffer(
+                    &GetThreadLocalScratchBuffers().Indexes,
+                    subBlockSize);
                 double* resultPtr = results.data();
                 for (size_t blockId = 0; blockId < cpuQuantizedFeatures->BlocksCount; ++blockId) {
                     auto subBlock = cpuQuantizedFeatures->ExtractBlock(blockId);
@@ -469,6 +600,109 @@ namespace NCB::NModelEvaluation {
                 }
             }
 
+            TIntrusivePtr<IQuantizedData> QuantizeFeatures(
+                TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+                TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+                const TFeatureLayout* featureInfo
+            ) const override {
+                if (!featureInfo) {
+                    featureInfo = ExtFeatureLayout.Get();
+                }
+                CB_ENSURE(
+                    ModelTrees->GetTextFeatures().empty(),
+                    "Features quantization is not implemented for models with text features"
+                );
+                ValidateInputFeatures(floatFeatures, catFeatures, {}, featureInfo);
+                const size_t docCount = Max(catFeatures.size(), floatFeatures.size());
+                auto result = MakeIntrusive<TCPUEvaluatorQuantizedData>();
+                TVector<ui8> quantizedDataHolder;
+                quantizedDataHolder.yresize(ModelTrees->GetEffectiveBinaryFeaturesBucketsCount() * docCount);
+                result->QuantizedData = TMaybeOwningArrayHolder<ui8>::CreateOwning(std::move(quantizedDataHolder));
+
+                const size_t blockSize = Min(FORMULA_EVALUATION_BLOCK_SIZE, docCount);
+                auto& scratchBuffers = GetThreadLocalScratchBuffers();
+                TCatFeatureHashCache catFeatureHashCache;
+                BinarizeFeatures(
+                    *ModelTrees,
+                    CtrProvider,
+                    TIntrusivePtr<TTextProcessingCollection>(),
+                    [&floatFeatures](TFeaturePosition position, size_t index) -> float {
+                        return floatFeatures[index][position.Index];
+                    },
+                    [&catFeatures, &catFeatureHashCache](TFeaturePosition position, size_t index) -> int {
+                        return catFeatureHashCache(catFeatures[index][position.Index]);
+                    },
+                    TCpuEvaluator::TextFeatureAccessorStub,
+                    0,
+                    docCount,
+                    result.Get(),
+                    TCPUEvaluatorScratchBuffers::GetBuffer(
+                        &scratchBuffers.TransposedHash,
+                        blockSize * ModelTrees->GetUsedCatFeaturesCount()),
+                    TCPUEvaluatorScratchBuffers::GetBuffer(
+                        &scratchBuffers.Ctrs,
+                        blockSize * ModelTrees->GetUsedModelCtrs().size()),
+                    TArrayRef<float>(),
+                    featureInfo
+                );
+                return result;
+            }
+
+            void CalcCascaded(
+                TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+                TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+                TConstArrayRef<TCascadeCheckpoint> checkpoints,
+                TArrayRef<double> results,
+                TArrayRef<ui32> evaluatedTreeCounts,
+                const TFeatureLayout* featureInfo
+            ) const override {
+                if (!featureInfo) {
+                    featureInfo = ExtFeatureLayout.Get();
+                }
+                CB_ENSURE(
+                    ModelTrees->GetDimensionsCount() == 1,
+                    "Cascaded evaluation is supported only for models with one-dimensional approx"
+                );
+                CB_ENSURE(
+                    ModelTrees->GetTextFeatures().empty(),
+                    "Cascaded evaluation is not implemented for models with text features"
+                );
+                for (size_t i = 0; i < checkpoints.size(); ++i) {
+                    CB_ENSURE(
+                        checkpoints[i].TreeEnd <= ModelTrees->GetTreeCount(),
+                        "Cascade checkpoint tree end " << checkpoints[i].TreeEnd << " exceeds model tree count "
+                        << ModelTrees->GetTreeCount()
+                    );
+                    CB_ENSURE(
+                        i == 0 || checkpoints[i - 1].TreeEnd <= checkpoints[i].TreeEnd,
+                        "Cascade checkpoints should be sorted by tree end"
+                    );
+                }
+                ValidateInputFeatures(floatFeatures, catFeatures, {}, featureInfo);
+                const size_t docCount = Max(catFeatures.size(), floatFeatures.size());
+                CB_ENSURE(results.size() == docCount, LabeledOutput(results.size(), docCount));
+                CB_ENSURE(
+                    evaluatedTreeCounts.empty() || evaluatedTreeCounts.size() == docCount,
+                    LabeledOutput(evaluatedTreeCounts.size(), docCount)
+                );
+                TCatFeatureHashCache catFeatureHashCache;
+                CalcCascadedGeneric(
+                    *ModelTrees,
+                    CtrProvider,
+                    [&floatFeatures](TFeaturePosition position, size_t index) -> float {
+                        return floatFeatures[index][position.Index];
+                    },
+                    [&catFeatures, &catFeatureHashCache](TFeaturePosition position, size_t index) -> int {
+                        return catFeatureHashCache(catFeatures[index][position.Index]);
+                    },
+                    docCount,
+                    checkpoints,
+                    results,
+                    evaluatedTreeCounts,
+                    featureInfo
+                );
+            }
+
             void CalcLeafIndexes(
                 const IQuantizedData* quantizedFeatures,
                 size_t treeStart,
@@ -492,12 +726,13 @@ namespace NCB::NModelEvaluation {
                 );
                 size_t treeCount = treeEnd - treeStart;
                 CB_ENSURE(indexes.size() == treeCount * cpuQuantizedFeatures->ObjectsCount);
-                TVector<TCalcerIndexType> tmpLeafIndexHolder;
+                auto& scratchBuffers = GetThreadLocalScratchBuffers();
                 TCalcerIndexType* indexesWritePtr = indexes.data();
                 for (size_t blockId = 0; blockId < cpuQuantizedFeatures->BlocksCount; ++blockId) {
                     auto subBlock = cpuQuantizedFeatures->ExtractBlock(blockId);
-                    tmpLeafIndexHolder.yresize(subBlock.GetObjectsCount() * treeCount);
-                    TCalcerIndexType* transposedLeafIndexesPtr = tmpLeafIndexHolder.data();
+                    TCalcerIndexType* transposedLeafIndexesPtr = TCPUEvaluatorScratchBuffers::GetBuffer(
+                        &scratchBuffers.Indexes,
+                        subBlock.GetObjectsCount() * treeCount).data();
                     calcFunction(
                         *ModelTrees,
                         &subBlock,
@@ -598,6 +833,8 @@ namespace NCB::NModelEvaluation {
             const TIntrusivePtr<TTextProcessingCollection> TextProcessingCollection;
             EPredictionType PredictionType = EPredictionType::RawFormulaVal;
             TMaybe<TFeatureLayout> ExtFeatureLayout;
+            // clones share the trees and so the cache
+            const TAtomicSharedPtr<TFeaturesToBinarizeCache> FeaturesToBinarizeCache;
         };
     }
 
@@ -1 +1,74 @@
 #include "quantization.h"
+
+namespace NCB::NModelEvaluation {
+    TMaybe<TFeaturesToBinarize> GetFeaturesToBinarize(const TModelTrees& trees, size_t treeStart, size_t treeEnd) {
+        const size_t treeCount = trees.GetTreeCount();
+        treeEnd = Min(treeEnd, treeCount);
+        if (treeStart == 0 && treeEnd == treeCount) {
+            return Nothing();
+        }
+        CB_ENSURE(treeStart <= treeEnd, "Invalid tree range [" << treeStart << ", " << treeEnd << ")");
+        const auto& treeStartOffsets = trees.GetModelTreeData()->GetTreeStartOffsets();
+        const auto& repackedBins = trees.GetRepackedBins();
+        const size_t binsBegin = treeStart < treeCount ? treeStartOffsets[treeStart] : repackedBins.size();
+        const size_t binsEnd = treeEnd < treeCount ? treeStartOffsets[treeEnd] : repackedBins.size();
+
+        TFeaturesToBinarize result;
+        result.Buckets.resize(trees.GetEffectiveBinaryFeaturesBucketsCount(), false);
+        for (size_t binIdx = binsBegin; binIdx < binsEnd; ++binIdx) {
+            result.Buckets[repackedBins[binIdx].FeatureIndex] = true;
+        }
+
+        size_t ctrBucketCount = 0;
+        for (const auto& ctr : trees.GetCtrFeatures()) {
+            ctrBucketCount += (ctr.Borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN;
+        }
+        const size_t firstCtrBucket = result.Buckets.size() - ctrBucketCount;
+
+        bool needAllNonCtrBuckets = false;
+        result.CtrFeatures.resize(trees.GetCtrFeatures().size(), false);
+        size_t bucketIdx = firstCtrBucket;
+        for (size_t ctrIdx = 0; ctrIdx < trees.GetCtrFeatures().size(); ++ctrIdx) {
+            const auto& ctr = trees.GetCtrFeatures()[ctrIdx];
+            const size_t bucketCount = (ctr.Borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN;
+            if (IsBucketRangeNeeded(&result, bucketIdx, bucketCount)) {
+                result.CtrFeatures[ctrIdx] = true;
+                result.UsedModelCtrs.push_back(ctr.Ctr);
+                const auto& projection = ctr.Ctr.Base.Projection;
+                // ctr providers read binarized float and one-hot features of the projection from quantized data
+                needAllNonCtrBuckets |= !projection.BinFeatures.empty() || !projection.OneHotFeatures.empty();
+            }
+            bucketIdx += bucketCount;
+        }
+        if (needAllNonCtrBuckets) {
+            std::fill(result.Buckets.begin(), result.Buckets.begin() + firstCtrBucket, true);
+        }
+        return result;
+    }
+
+    TAtomicSharedPtr<const TFeaturesToBinarize> TFeaturesToBinarizeCache::Get(
+        const TModelTrees& trees,
+        size_t treeStart,
+        size_t treeEnd
+    ) {
+        treeEnd = Min(treeEnd, trees.GetTreeCount());
+        if (treeStart == 0 && treeEnd == trees.GetTreeCount()) {
+            return nullptr;
+        }
+        const auto key = std::make_pair(treeStart, treeEnd);
+        with_lock(Lock) {
+            if (const auto* cached = Cache.FindPtr(key)) {
+                return *cached;
+            }
+        }
+        auto featuresToBinarize = GetFeaturesToBinarize(trees, treeStart, treeEnd);
+        TAtomicSharedPtr<const TFeaturesToBinarize> result = MakeAtomicShared<TFeaturesToBinarize>(
+            std::move(featuresToBinarize.GetRef())
+        );
+        TGuard<TAdaptiveLock> guard(Lock);
+        if (Cache.size() >= MaxCachedRangeCount) {
+            Cache.clear();
+        }
+        return Cache.emplace(key, result).first->second;
+    }
+}
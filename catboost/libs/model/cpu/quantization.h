@@ -10,7 +10,12 @@
 
 #include <util/generic/array_ref.h>
 #include <util/generic/hash.h>
+#include <util/generic/maybe.h>
+#include <util/generic/ptr.h>
 #include <util/generic/ymath.h>
+#include <util/system/spinlock.h>
+
+#include <utility>
 
 namespace NCB::NModelEvaluation {
     constexpr size_t FORMULA_EVALUATION_BLOCK_SIZE = 128;
@@ -53,13 +58,15 @@ namespace NCB::NModelEvaluation {
 
     inline void OneHotBinsFromTransposedCatFeatures(
         const TConstArrayRef<TOneHotFeature> OneHotFeatures,
-        const THashMap<int, int> catFeaturePackedIndex,
+        const TConstArrayRef<ui32> oneHotFeaturesUsedCatIndexes,
         const size_t docCount,
         TArrayRef<ui32> transposedHash,
         ui8*& result
     ) {
-        for (const auto& oheFeature : OneHotFeatures) {
-            const auto catIdx = catFeaturePackedIndex.at(oheFeature.CatFeatureIndex);
+        Y_ASSERT(OneHotFeatures.size() == oneHotFeaturesUsedCatIndexes.size());
+        for (size_t oheIdx = 0; oheIdx < OneHotFeatures.size(); ++oheIdx) {
+            const auto& oheFeature = OneHotFeatures[oheIdx];
+            const auto catIdx = oneHotFeaturesUsedCatIndexes[oheIdx];
             for (size_t docId = 0; docId < docCount; ++docId) {
                 static_assert(sizeof(int) >= sizeof(i32));
                 const int val = *reinterpret_cast<i32*>(&(transposedHash[catIdx * docCount + docId]));
@@ -140,10 +147,51 @@ namespace NCB::NModelEvaluation {
         result += docCount * ((borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN);
     }
 
+    // number of borders less than val, i.e. the bin of val for the whole borders array; 0 for NaN
+    Y_FORCE_INLINE ui32 CalcBinBySortedBorders(const TConstArrayRef<float> borders, float val) {
+        const float* base = borders.data();
+        size_t size = borders.size();
+        while (size > 1) {
+            const size_t half = size / 2;
+            base = (base[half] < val) ? base + half : base;
+            size -= half;
+        }
+        return (base - borders.data()) + (*base < val);
+    }
+
+    template <bool UseNanSubstitution, typename TFloatFeatureAccessor>
+    Y_FORCE_INLINE void BinarizeFloatsBinarySearch(
+        TFeaturePosition position,
+        const size_t docCount,
+        TFloatFeatureAccessor floatAccessor,
+        const TConstArrayRef<float> borders,
+        size_t start,
+        ui8*& result,
+        const float nanSubstitutionValue = 0.0f
+    ) {
+        Y_ASSERT(!borders.empty());
+        for (size_t docId = 0; docId < docCount; ++docId) {
+            float val = floatAccessor(position, start + docId);
+            if (UseNanSubstitution) {
+                if (std::isnan(val)) {
+                    val = nanSubstitutionValue;
+                }
+            }
+            const size_t bin = CalcBinBySortedBorders(borders, val);
+            ui8* writePtr = result + docId;
+            for (size_t blockStart = 0; blockStart < borders.size(); blockStart += MAX_VALUES_PER_BIN) {
+                const size_t blockEnd = Min<size_t>(blockStart + MAX_VALUES_PER_BIN, borders.size());
+                *writePtr = (ui8)(ClampVal(bin, blockStart, blockEnd) - blockStart);
+                writePtr += docCount;
+            }
+        }
+        result += docCount * ((borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN);
+    }
+
 #ifndef ARCADIA_SSE
 
     template <bool UseNanSubstitution, typename TFloatFeatureAccessor>
-    Y_FORCE_INLINE void BinarizeFloats(
+    Y_FORCE_INLINE void BinarizeFloatsLinear(
         TFeaturePosition position,
         const size_t docCount,
         TFloatFeatureAccessor floatAccessor,
@@ -166,7 +214,7 @@ namespace NCB::NModelEvaluation {
 #else
 
     template <bool UseNanSubstitution, typename TFloatFeatureAccessor>
-    Y_FORCE_INLINE void BinarizeFloats(
+    Y_FORCE_INLINE void BinarizeFloatsLinear(
         TFeaturePosition position,
         const size_t docCount,
         TFloatFeatureAccessor floatAccessor,
@@ -258,6 +306,89 @@ namespace NCB::NModelEvaluation {
 
 #endif
 
+    // comparing with each border is vectorized, so binary search pays off only for features with many borders
+    constexpr size_t BINARY_SEARCH_BINARIZATION_MIN_BORDERS = 64;
+
+    template <bool UseNanSubstitution, typename TFloatFeatureAccessor>
+    Y_FORCE_INLINE void BinarizeFloats(
+        TFeaturePosition position,
+        const size_t docCount,
+        TFloatFeatureAccessor floatAccessor,
+        const TConstArrayRef<float> borders,
+        size_t start,
+        ui8*& result,
+        const float nanSubstitutionValue = 0.0f
+    ) {
+        if (borders.size() >= BINARY_SEARCH_BINARIZATION_MIN_BORDERS) {
+            BinarizeFloatsBinarySearch<UseNanSubstitution, TFloatFeatureAccessor>(
+                position,
+                docCount,
+                floatAccessor,
+                borders,
+                start,
+                result,
+                nanSubstitutionValue
+            );
+        } else {
+            BinarizeFloatsLinear<UseNanSubstitution, TFloatFeatureAccessor>(
+                position,
+                docCount,
+                floatAccessor,
+                borders,
+                start,
+                result,
+                nanSubstitutionValue
+            );
+        }
+    }
+
+    /**
+     * Binarized features buckets and ctrs needed to evaluate a range of trees. Buckets keep their positions
+     * in quantized data, buckets that are not needed are left zeroed.
+     */
+    struct TFeaturesToBinarize {
+        TVector<bool> Buckets;      // by effective binary features bucket index
+        TVector<bool> CtrFeatures;  // by index in trees.GetCtrFeatures()
+        TVector<TModelCtr> UsedModelCtrs;
+    };
+
+    /**
+     * @return features needed by trees [treeStart, treeEnd) or Nothing() if all features are needed
+     */
+    TMaybe<TFeaturesToBinarize> GetFeaturesToBinarize(const TModelTrees& trees, size_t treeStart, size_t treeEnd);
+
+    /**
+     * Caches GetFeaturesToBinarize results by tree range. Should only be used with the trees it was first used with,
+     * evaluators own one per trees snapshot.
+     */
+    class TFeaturesToBinarizeCache {
+    public:
+        /**
+         * @return features needed by trees [treeStart, treeEnd) or nullptr if all features are needed
+         */
+        TAtomicSharedPtr<const TFeaturesToBinarize> Get(const TModelTrees& trees, size_t treeStart, size_t treeEnd);
+
+    private:
+        // tree ranges come from callers, so the cache is dropped when it grows past this size
+        static constexpr size_t MaxCachedRangeCount = 64;
+
+        TAdaptiveLock Lock;
+        THashMap<std::pair<size_t, size_t>, TAtomicSharedPtr<const TFeaturesToBinarize>> Cache;
+    };
+
+    inline bool IsBucketRangeNeeded(
+        const TFeaturesToBinarize* featuresToBinarize,
+        size_t firstBucket,
+        size_t bucketCount
+    ) {
+        if (!featuresToBinarize) {
+            return true;
+        }
+        const auto& buckets = featuresToBinarize->Buckets;
+        return std::find(buckets.begin() + firstBucket, buckets.begin() + firstBucket + bucketCount, true)
+            != buckets.begin() + firstBucket + bucketCount;
+    }
+
 /**
 * This function binarizes
 */
@@ -275,7 +406,8 @@ namespace NCB::NModelEvaluation {
         TArrayRef<ui32> transposedHash,
         TArrayRef<float> ctrs,
         TArrayRef<float> estimatedFeatures,
-        const TFeatureLayout* featureInfo = nullptr
+        const TFeatureLayout* featureInfo = nullptr,
+        const TFeaturesToBinarize* featuresToBinarize = nullptr
     ) {
         const auto fullDocCount = end - start;
         auto result = *(cpuEvaluatorQuantizedData->QuantizedData);
@@ -291,10 +423,18 @@ namespace NCB::NModelEvaluation {
             ui8* resultPtrForBlockStart = resultPtr;
             ++cpuEvaluatorQuantizedData->BlocksCount;
             auto docCount = Min(end - start, FORMULA_EVALUATION_BLOCK_SIZE);
+            size_t bucketIdx = 0;
             for (const auto& floatFeature : trees.GetFloatFeatures()) {
                 if (!floatFeature.UsedInModel()) {
                     continue;
                 }
+                const size_t bucketCount = (floatFeature.Borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN;
+                if (!IsBucketRangeNeeded(featuresToBinarize, bucketIdx, bucketCount)) {
+                    resultPtr += docCount * bucketCount;
+                    bucketIdx += bucketCount;
+                    continue;
+                }
+                bucketIdx += bucketCount;
                 TFeaturePosition position = floatFeature.Position;
                 if (featureInfo) {
                     position = featureInfo->GetRemappedPosition(floatFeature);
@@ -379,6 +519,14 @@ namespace NCB::NModelEvaluation {
                 }
 
                 for (const auto& estimatedFeature : trees.GetEstimatedFeatures()) {
+                    const size_t bucketCount =
+                        (estimatedFeature.Borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN;
+                    if (!IsBucketRangeNeeded(featuresToBinarize, bucketIdx, bucketCount)) {
+                        resultPtr += docCount * bucketCount;
+                        bucketIdx += bucketCount;
+                        continue;
+                    }
+                    bucketIdx += bucketCount;
                     const ui32 featureOffset =
                         textProcessingCollection->GetAbsoluteCalcerOffset(estimatedFeature.CalcerId)
                         + estimatedFeature.LocalIndex;
@@ -398,13 +546,11 @@ namespace NCB::NModelEvaluation {
                 }
             }
             if (trees.GetUsedCatFeaturesCount() != 0) {
-                THashMap<int, int> catFeaturePackedIndexes;
                 int usedFeatureIdx = 0;
                 for (const auto& catFeature : trees.GetCatFeatures()) {
                     if (!catFeature.UsedInModel()) {
                         continue;
                     }
-                    catFeaturePackedIndexes[catFeature.Position.Index] = usedFeatureIdx;
                     TFeaturePosition position = catFeature.Position;
                     if (featureInfo) {
                         position = featureInfo->GetRemappedPosition(catFeature);
@@ -419,14 +565,14 @@ namespace NCB::NModelEvaluation {
                 Y_ASSERT(trees.GetUsedCatFeaturesCount() == (size_t)usedFeatureIdx);
                 OneHotBinsFromTransposedCatFeatures(
                     trees.GetOneHotFeatures(),
-                    catFeaturePackedIndexes,
+                    trees.GetOneHotFeaturesUsedCatIndexes(),
                     docCount,
                     transposedHash,
                     resultPtr
                 );
                 if (!trees.GetUsedModelCtrs().empty()) {
                     ctrProvider->CalcCtrs(
-                        trees.GetUsedModelCtrs(),
+                        featuresToBinarize ? MakeConstArrayRef(featuresToBinarize->UsedModelCtrs) : trees.GetUsedModelCtrs(),
                         TConstArrayRef<ui8>(resultPtrForBlockStart, docCount * trees.GetEffectiveBinaryFeaturesBucketsCount()),
                         transposedHash,
                         docCount,
@@ -434,7 +580,12 @@ namespace NCB::NModelEvaluation {
                     );
                 }
                 size_t ctrFloatsPosition = 0;
-                for (const auto& ctr : trees.GetCtrFeatures()) {
+                for (size_t ctrIdx = 0; ctrIdx < trees.GetCtrFeatures().size(); ++ctrIdx) {
+                    const auto& ctr = trees.GetCtrFeatures()[ctrIdx];
+                    if (featuresToBinarize && !featuresToBinarize->CtrFeatures[ctrIdx]) {
+                        resultPtr += docCount * ((ctr.Borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN);
+                        continue;
+                    }
                     auto ctrFloatsPtr = &ctrs[ctrFloatsPosition];
                     ctrFloatsPosition += docCount;
                     BinarizeFloats<false>(
@@ -294,6 +294,32 @@ namespace NCB::NModelEvaluation {
                 ythrow yexception() << "Unimplemented on GPU";
             }
 
+            TIntrusivePtr<IQuantizedData> QuantizeFeatures(
+                TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+                TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+                const TFeatureLayout*
+            ) const override {
+                Y_UNUSED(floatFeatures);
+                Y_UNUSED(catFeatures);
+                ythrow yexception() << "Unimplemented on GPU";
+            }
+
+            void CalcCascaded(
+                TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+                TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+                TConstArrayRef<TCascadeCheckpoint> checkpoints,
+                TArrayRef<double> results,
+                TArrayRef<ui32> evaluatedTreeCounts,
+                const TFeatureLayout*
+            ) const override {
+                Y_UNUSED(floatFeatures);
+                Y_UNUSED(catFeatures);
+                Y_UNUSED(checkpoints);
+                Y_UNUSED(results);
+                Y_UNUSED(evaluatedTreeCounts);
+                ythrow yexception() << "Unimplemented on GPU";
+            }
+
             void CalcLeafIndexes(
                 const IQuantizedData* quantizedFeatures,
                 size_t treeStart,
@@ -6,10 +6,11 @@ NCB::NModelEvaluation::TEvalResultProcessor::TEvalResultProcessor(
     size_t docCount,
     TArrayRef<double> results,
     NCB::NModelEvaluation::EPredictionType predictionType,
-    TScaleAndBias scaleAndBias,
+    const TScaleAndBias& scaleAndBias,
     ui32 approxDimension,
     ui32 blockSize,
-    TMaybe<double> binclassProbabilityBorder
+    TMaybe<double> binclassProbabilityBorder,
+    TVector<double>* intermediateBlockResultsBuffer
 )
     : Results(results)
     , PredictionType(predictionType)
@@ -23,7 +24,14 @@ NCB::NModelEvaluation::TEvalResultProcessor::TEvalResultProcessor(
         "`results` size is insufficient: " << LabeledOutput(Results.size(), resultApproxDimension, docCount * resultApproxDimension)
     );
     if (approxDimension > 1 && predictionType == EPredictionType::Class) {
-        IntermediateBlockResults.resize(blockSize * approxDimension);
+        if (!intermediateBlockResultsBuffer) {
+            intermediateBlockResultsBuffer = &IntermediateBlockResultsHolder;
+        }
+        if (intermediateBlockResultsBuffer->size() < blockSize * approxDimension) {
+            intermediateBlockResultsBuffer->yresize(blockSize * approxDimension);
+        }
+        IntermediateBlockResults = MakeArrayRef(intermediateBlockResultsBuffer->data(), blockSize * approxDimension);
+        Fill(IntermediateBlockResults.begin(), IntermediateBlockResults.end(), 0.0);
     }
     if (binclassProbabilityBorder.Defined() && predictionType == EPredictionType::Class &&
         approxDimension == 1) {
@@ -123,10 +123,11 @@ namespace NCB::NModelEvaluation {
             size_t docCount,
             TArrayRef<double> results,
             EPredictionType predictionType,
-            TScaleAndBias scaleAndBias,
+            const TScaleAndBias& scaleAndBias,
             ui32 approxDimension,
             ui32 blockSize,
-            TMaybe<double> binclassProbabilityBorder = Nothing()
+            TMaybe<double> binclassProbabilityBorder = Nothing(),
+            TVector<double>* intermediateBlockResultsBuffer = nullptr // reused between calls if provided
         );
 
         inline TArrayRef<double> GetResultBlockView(ui32 blockId, ui32 dimension) {
@@ -212,11 +213,12 @@ namespace NCB::NModelEvaluation {
     private:
         TArrayRef<double> Results;
         EPredictionType PredictionType;
-        TScaleAndBias ScaleAndBias;
+        const TScaleAndBias& ScaleAndBias;
         ui32 ApproxDimension;
         ui32 BlockSize;
 
-        TVector<double> IntermediateBlockResults;
+        TVector<double> IntermediateBlockResultsHolder;
+        TArrayRef<double> IntermediateBlockResults;
 
         double BinclassRawValueBorder = 0.0;
     };
@@ -9,6 +9,11 @@
 #include <util/generic/array_ref.h>
 #include <util/generic/maybe.h>
 #include <util/generic/ptr.h>
+#include <util/generic/strbuf.h>
+#include <util/generic/utility.h>
+#include <util/generic/vector.h>
+
+#include <limits>
 
 namespace NCB {  // split due to CUDA-compiler inability to parse nested namespace definitions
     namespace NModelEvaluation {
@@ -53,6 +58,40 @@ namespace NCB {  // split due to CUDA-compiler inability to parse nested namespa
             }
         };
 
+        /**
+         * Checkpoint of cascaded evaluation: after trees [0, TreeEnd) are applied, objects with partial raw
+         * formula value <= LowerThreshold or >= UpperThreshold are considered decided and are not evaluated further.
+         */
+        struct TCascadeCheckpoint {
+            size_t TreeEnd = 0;
+            double LowerThreshold = -std::numeric_limits<double>::infinity();
+            double UpperThreshold = std::numeric_limits<double>::infinity();
+        };
+
+        /**
+         * Temporary argument conversion buffers for Calc overloads taking vectors of strings.
+         * Calls for at most MaxObjectCountForThreadLocalBuffers objects reuse a thread-local instance,
+         * larger calls use a temporary one, so memory retained by a thread does not grow with batch size.
+         */
+        struct TCalcArgumentBuffers {
+            static constexpr size_t MaxObjectCountForThreadLocalBuffers = 1024;
+
+            TVector<TStringBuf> CatFeatureStrings;
+            TVector<TConstArrayRef<TStringBuf>> CatFeatureStringRefs;
+            TVector<TConstArrayRef<TStringBuf>> TextFeatureStringRefs;
+            TVector<TConstArrayRef<float>> FloatRefs;
+
+        public:
+            static TCalcArgumentBuffers& GetThreadLocal() {
+                static thread_local TCalcArgumentBuffers buffers;
+                return buffers;
+            }
+
+            static TCalcArgumentBuffers& Get(size_t objectCount, TCalcArgumentBuffers* largeBatchBuffers) {
+                return objectCount <= MaxObjectCountForThreadLocalBuffers ? GetThreadLocal() : *largeBatchBuffers;
+            }
+        };
+
         class IModelEvaluator {
         public:
             virtual ~IModelEvaluator() = default;
@@ -205,13 +244,20 @@ namespace NCB {  // split due to CUDA-compiler inability to parse nested namespa
                 TArrayRef<double> results,
                 const TFeatureLayout* featureInfo = nullptr
             ) const {
-                TVector<TVector<TStringBuf>> catFeatureString(Reserve(catFeatures.size()));
-                for (const auto& objCatFeature : catFeatures) {
-                    catFeatureString.emplace_back(TVector<TStringBuf>{objCatFeature.begin(), objCatFeature.end()});
+                TCalcArgumentBuffers largeBatchBuffers;
+                auto& buffers = TCalcArgumentBuffers::Get(Max(floatFeatures.size(), catFeatures.size()), &largeBatchBuffers);
+
+                buffers.CatFeatureStrings.clear();
+                for (const auto& objCatFeatures : catFeatures) {
+                    buffers.CatFeatureStrings.insert(buffers.CatFeatureStrings.end(), objCatFeatures.begin(), objCatFeatures.end());
                 }
-                TVector<TConstArrayRef<float>> floatRefs(floatFeatures.begin(), floatFeatures.end());
-                TVector<TConstArrayRef<TStringBuf>> catFeatureStringRefs(catFeatureString.begin(), catFeatureString.end());
-                Calc<TStringBuf>(floatRefs, catFeatureStringRefs, results, featureInfo);
+                buffers.CatFeatureStringRefs.clear();
+                for (size_t objIdx = 0, offset = 0; objIdx < catFeatures.size(); ++objIdx) {
+                    buffers.CatFeatureStringRefs.emplace_back(buffers.CatFeatureStrings.data() + offset, catFeatures[objIdx].size());
+                    offset += catFeatures[objIdx].size();
+                }
+                buffers.FloatRefs.assign(floatFeatures.begin(), floatFeatures.end());
+                Calc<TStringBuf>(buffers.FloatRefs, buffers.CatFeatureStringRefs, results, featureInfo);
             }
 
             virtual void Calc(
@@ -221,6 +267,33 @@ namespace NCB {  // split due to CUDA-compiler inability to parse nested namespa
                 TArrayRef<double> results
             ) const = 0;
 
+            /**
+             * Binarize objects features with model borders. Result can be evaluated with Calc(quantizedFeatures, ...)
+             * on any tree range of this model or of any model with the same features quantization.
+             */
+            virtual TIntrusivePtr<IQuantizedData> QuantizeFeatures(
+                TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+                TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+                const TFeatureLayout* featureInfo = nullptr
+            ) const = 0;
+
+            /**
+             * Evaluate raw formula values with early exit: objects stop at the first checkpoint whose thresholds
+             * they pass, the rest continue with the next trees; after the last checkpoint all trees are applied.
+             * Supported only for models with one-dimensional approx, prediction type is ignored.
+             * @param checkpoints sorted by TreeEnd
+             * @param results raw formula value (scale and bias applied) on the trees evaluated for each object
+             * @param evaluatedTreeCounts optional, number of trees evaluated for each object
+             */
+            virtual void CalcCascaded(
+                TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+                TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+                TConstArrayRef<TCascadeCheckpoint> checkpoints,
+                TArrayRef<double> results,
+                TArrayRef<ui32> evaluatedTreeCounts,
+                const TFeatureLayout* featureInfo = nullptr
+            ) const = 0;
+
             virtual void CalcLeafIndexesSingle(
                 TConstArrayRef<float> floatFeatures,
                 TConstArrayRef<TStringBuf> catFeatures,
@@ -243,7 +243,7 @@ void TModelTrees::AddBinTree(const TVector<int>& binSplits) {
 }
 
 void TModelTrees::ClearLeafWeights() {
-    CastToSolidTree(*this)->LeafWeights.clear();
+    TVector<double>().swap(CastToSolidTree(*this)->LeafWeights);
 }
 
 void TModelTrees::AddTreeSplit(int treeSplit) {
@@ -271,11 +271,8 @@ bool TModelTrees::IsSolid() const {
     return dynamic_cast<TSolidModelTree*>(ModelTreeData.Get());
 }
 
-void TModelTrees::TruncateTrees(size_t begin, size_t end) {
-    //TODO(eermishkina): support non symmetric trees
-    CB_ENSURE(IsOblivious(), "Truncate support only symmetric trees");
-    CB_ENSURE(begin <= end, "begin tree index should be not greater than end tree index.");
-    CB_ENSURE(end <= GetModelTreeData()->GetTreeSplits().size(), "end tree index should be not greater than tree count.");
+void TModelTrees::RebuildObliviousTrees(TConstArrayRef<size_t> treeIndexes) {
+    Y_ASSERT(IsOblivious());
     auto savedScaleAndBias = GetScaleAndBias();
     TObliviousTreeBuilder builder(FloatFeatures, CatFeatures, TextFeatures, ApproxDimension);
     const auto& leafOffsets = RuntimeData->TreeFirstLeafOffsets;
@@ -285,7 +282,7 @@ void TModelTrees::TruncateTrees(size_t begin, size_t end) {
     const auto leafValues = GetModelTreeData()->GetLeafValues();
     const auto leafWeights = GetModelTreeData()->GetLeafWeights();
     const auto treeStartOffsets = GetModelTreeData()->GetTreeStartOffsets();
-    for (size_t treeIdx = begin; treeIdx < end; ++treeIdx) {
+    for (size_t treeIdx : treeIndexes) {
         TVector<TModelSplit> modelSplits;
         for (int splitIdx = treeStartOffsets[treeIdx];
              splitIdx < treeStartOffsets[treeIdx] + treeSizes[treeIdx];
@@ -310,6 +307,42 @@ void TModelTrees::TruncateTrees(size_t begin, size_t end) {
     this->SetScaleAndBias(savedScaleAndBias);
 }
 
+void TModelTrees::TruncateTrees(size_t begin, size_t end) {
+    //TODO(eermishkina): support non symmetric trees
+    CB_ENSURE(IsOblivious(), "Truncate support only symmetric trees");
+    CB_ENSURE(begin <= end, "begin tree index should be not greater than end tree index.");
+    CB_ENSURE(end <= GetModelTreeData()->GetTreeSplits().size(), "end tree index should be not greater than tree count.");
+    TVector<size_t> treeIndexes(end - begin);
+    Iota(treeIndexes.begin(), treeIndexes.end(), begin);
+    RebuildObliviousTrees(treeIndexes);
+}
+
+TVector<size_t> TModelTrees::GetTreesOrderForEvaluation() const {
+    CB_ENSURE(IsOblivious(), "Trees reordering supports only symmetric trees");
+    const auto treeSizes = GetModelTreeData()->GetTreeSizes();
+    const auto treeStartOffsets = GetModelTreeData()->GetTreeStartOffsets();
+    const auto repackedBins = GetRepackedBins();
+    TVector<TVector<ui16>> treeBuckets(treeSizes.size());
+    for (size_t treeIdx = 0; treeIdx < treeSizes.size(); ++treeIdx) {
+        for (int splitIdx = treeStartOffsets[treeIdx]; splitIdx < treeStartOffsets[treeIdx] + treeSizes[treeIdx]; ++splitIdx) {
+            treeBuckets[treeIdx].push_back(repackedBins[splitIdx].FeatureIndex);
+        }
+        SortUnique(treeBuckets[treeIdx]);
+    }
+    TVector<size_t> order(treeSizes.size());
+    Iota(order.begin(), order.end(), 0);
+    StableSort(order, [&] (size_t lhs, size_t rhs) { return treeBuckets[lhs] < treeBuckets[rhs]; });
+    return order;
+}
+
+void TModelTrees::ReorderTreesForEvaluation() {
+    const auto order = GetTreesOrderForEvaluation();
+    if (IsSorted(order.begin(), order.end())) {
+        return;
+    }
+    RebuildObliviousTrees(order);
+}
+
 flatbuffers::Offset<NCatBoostFbs::TModelTrees>
 TModelTrees::FBSerialize(TModelPartsCachingSerializer& serializer) const {
     auto& builder = serializer.FlatbufBuilder;
@@ -464,13 +497,18 @@ void TModelTrees::UpdateRuntimeData() const {
         ref.EffectiveBinFeaturesBucketCount
             += (feature.Borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN;
     }
+    THashMap<int, ui32> catFeatureUsedIndexes;
     for (const auto& feature : CatFeatures) {
         if (!feature.UsedInModel()) {
             continue;
         }
+        catFeatureUsedIndexes[feature.Position.Index] = ref.UsedCatFeaturesCount;
         ++ref.UsedCatFeaturesCount;
         ref.MinimalSufficientCatFeaturesVectorSize = static_cast<size_t>(feature.Position.Index) + 1;
     }
+    for (const auto& feature : OneHotFeatures) {
+        ref.OneHotFeaturesUsedCatIndexes.push_back(catFeatureUsedIndexes.at(feature.CatFeatureIndex));
+    }
     for (const auto& feature : TextFeatures) {
         if (!feature.UsedInModel()) {
             continue;
@@ -934,8 +972,10 @@ void TFullModel::Calc(
     TArrayRef<double> results,
     const TFeatureLayout* featureInfo
 ) const {
-    TVector<TConstArrayRef<TStringBuf>> stringbufVecRefs{catFeatures.begin(), catFeatures.end()};
-    GetCurrentEvaluator()->Calc(floatFeatures, stringbufVecRefs, treeStart, treeEnd, results, featureInfo);
+    NCB::NModelEvaluation::TCalcArgumentBuffers largeBatchBuffers;
+    auto& buffers = NCB::NModelEvaluation::TCalcArgumentBuffers::Get(catFeatures.size(), &largeBatchBuffers);
+    buffers.CatFeatureStringRefs.assign(catFeatures.begin(), catFeatures.end());
+    GetCurrentEvaluator()->Calc(floatFeatures, buffers.CatFeatureStringRefs, treeStart, treeEnd, results, featureInfo);
 }
 
 void TFullModel::Calc(
@@ -947,9 +987,71 @@ void TFullModel::Calc(
     TArrayRef<double> results,
     const TFeatureLayout* featureInfo
 ) const {
-    TVector<TConstArrayRef<TStringBuf>> stringbufCatVecRefs{catFeatures.begin(), catFeatures.end()};
-    TVector<TConstArrayRef<TStringBuf>> stringbufTextVecRefs{textFeatures.begin(), textFeatures.end()};
-    GetCurrentEvaluator()->Calc(floatFeatures, stringbufCatVecRefs, stringbufTextVecRefs, treeStart, treeEnd, results, featureInfo);
+    NCB::NModelEvaluation::TCalcArgumentBuffers largeBatchBuffers;
+    auto& buffers = NCB::NModelEvaluation::TCalcArgumentBuffers::Get(
+        Max(catFeatures.size(), textFeatures.size()),
+        &largeBatchBuffers);
+    buffers.CatFeatureStringRefs.assign(catFeatures.begin(), catFeatures.end());
+    buffers.TextFeatureStringRefs.assign(textFeatures.begin(), textFeatures.end());
+    GetCurrentEvaluator()->Calc(floatFeatures, buffers.CatFeatureStringRefs, buffers.TextFeatureStringRefs, treeStart, treeEnd, results, featureInfo);
+}
+
+TIntrusivePtr<NCB::NModelEvaluation::IQuantizedData> TFullModel::QuantizeFeatures(
+    TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+    TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+    const TFeatureLayout* featureInfo
+) const {
+    return GetCurrentEvaluator()->QuantizeFeatures(floatFeatures, catFeatures, featureInfo);
+}
+
+void TFullModel::Calc(
+    const NCB::NModelEvaluation::IQuantizedData* quantizedFeatures,
+    size_t treeStart,
+    size_t treeEnd,
+    TArrayRef<double> results
+) const {
+    GetCurrentEvaluator()->Calc(quantizedFeatures, treeStart, treeEnd, results);
+}
+
+void TFullModel::CalcCascaded(
+    TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+    TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+    TConstArrayRef<NCB::NModelEvaluation::TCascadeCheckpoint> checkpoints,
+    TArrayRef<double> results,
+    TArrayRef<ui32> evaluatedTreeCounts,
+    const TFeatureLayout* featureInfo
+) const {
+    GetCurrentEvaluator()->CalcCascaded(floatFeatures, catFeatures, checkpoints, results, evaluatedTreeCounts, featureInfo);
+}
+
+bool TFullModel::HasSameFeaturesQuantization(const TFullModel& other) const {
+    if (ModelTrees.Get() == other.ModelTrees.Get()) {
+        return true;
+    }
+    const auto& trees = *ModelTrees;
+    const auto& otherTrees = *other.ModelTrees;
+    const auto binFeatures = trees.GetBinFeatures();
+    const auto otherBinFeatures = otherTrees.GetBinFeatures();
+    if (trees.GetEffectiveBinaryFeaturesBucketsCount() != otherTrees.GetEffectiveBinaryFeaturesBucketsCount() ||
+        binFeatures.size() != otherBinFeatures.size() ||
+        !std::equal(binFeatures.begin(), binFeatures.end(), otherBinFeatures.begin()))
+    {
+        return false;
+    }
+    const auto floatFeatures = trees.GetFloatFeatures();
+    const auto otherFloatFeatures = otherTrees.GetFloatFeatures();
+    if (floatFeatures.size() != otherFloatFeatures.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < floatFeatures.size(); ++i) {
+        if (floatFeatures[i].HasNans != otherFloatFeatures[i].HasNans ||
+            floatFeatures[i].NanValueTreatment != otherFloatFeatures[i].NanValueTreatment)
+        {
+            return false;
+        }
+    }
+    // ctr values depend on ctr tables, so models with ctrs are compatible only with the same ctr provider
+    return trees.GetUsedModelCtrs().empty() || CtrProvider == other.CtrProvider;
 }
 
 void TFullModel::CalcLeafIndexesSingle(
@@ -1291,6 +1393,54 @@ TVector<NJson::TJsonValue> TFullModel::GetModelClassLabels() const {
     return classLabels;
 }
 
+static size_t GetModelInfoSize(const THashMap<TString, TString>& modelInfo) {
+    size_t size = 0;
+    for (const auto& [key, value] : modelInfo) {
+        size += key.size() + value.size();
+    }
+    return size;
+}
+
+size_t TFullModel::DropTrainingOnlyData() {
+    size_t droppedSize = 0;
+    const size_t leafWeightsCount = ModelTrees->GetModelTreeData()->GetLeafWeights().size();
+    if (leafWeightsCount != 0 && ModelTrees->IsSolid()) {
+        ModelTrees.GetMutable()->ClearLeafWeights();
+        UpdateDynamicData();
+        droppedSize += leafWeightsCount * sizeof(double);
+    }
+
+    THashMap<TString, TString> evaluationModelInfo;
+    for (const auto& key : {"class_params", "multiclass_params", "loss_function"}) {
+        if (ModelInfo.contains(key)) {
+            evaluationModelInfo[key] = ModelInfo.at(key);
+        }
+    }
+    if (ModelInfo.contains("params")) {
+        const NJson::TJsonValue params = ReadTJsonValue(ModelInfo.at("params"));
+        NJson::TJsonValue evaluationParams(NJson::JSON_MAP);
+        if (params.Has("loss_function")) {
+            evaluationParams["loss_function"] = params["loss_function"];
+        }
+        if (params.Has("data_processing_options") && params["data_processing_options"].Has("class_names")) {
+            evaluationParams["data_processing_options"]["class_names"]
+                = params["data_processing_options"]["class_names"];
+        }
+        if (params.Has("boosting_options")) {
+            // used by virtual ensembles predictions
+            for (const auto& option : {"posterior_sampling", "learning_rate", "model_shrink_rate"}) {
+                if (params["boosting_options"].Has(option)) {
+                    evaluationParams["boosting_options"][option] = params["boosting_options"][option];
+                }
+            }
+        }
+        evaluationModelInfo["params"] = WriteTJsonValue(evaluationParams);
+    }
+    droppedSize += GetModelInfoSize(ModelInfo) - GetModelInfoSize(evaluationModelInfo);
+    ModelInfo.swap(evaluationModelInfo);
+    return droppedSize;
+}
+
 void TFullModel::UpdateEstimatedFeaturesIndices(TVector<TEstimatedFeature>&& newEstimatedFeatures) {
     CB_ENSURE(
         TextProcessingCollection,
@@ -148,6 +148,10 @@ public:
          * List of all TModelCTR used in model
          */
         TVector<TModelCtr> UsedModelCtrs;
+        /**
+         * Index of source categorical feature among used categorical features for each one hot feature
+         */
+        TVector<ui32> OneHotFeaturesUsedCatIndexes;
         /**
          * List of all binary with indexes corresponding to TreeSplits values
          */
@@ -408,6 +412,19 @@ public:
      */
     void TruncateTrees(size_t begin, size_t end);
 
+    /**
+     * Order of oblivious trees for evaluation: trees splitting on the same binarized features buckets are placed
+     * next to each other so that consecutive trees read the same columns of quantized data.
+     * @return tree indexes in evaluation order
+     */
+    TVector<size_t> GetTreesOrderForEvaluation() const;
+
+    /**
+     * Reorder oblivious trees as GetTreesOrderForEvaluation suggests. Predictions on the full model are unchanged
+     * up to the order of floating point summation, but tree ranges no longer correspond to boosting iterations.
+     */
+    void ReorderTreesForEvaluation();
+
     /**
      * Drop unused float and categorical features from model
      */
@@ -427,6 +444,11 @@ public:
         CB_ENSURE(RuntimeData.Defined(), "runtime data should be initialized");
         return RuntimeData->UsedModelCtrs;
     }
+
+    TConstArrayRef<ui32> GetOneHotFeaturesUsedCatIndexes() const {
+        CB_ENSURE(RuntimeData.Defined(), "runtime data should be initialized");
+        return RuntimeData->OneHotFeaturesUsedCatIndexes;
+    }
     /**
      * List all binary features corresponding to binary feature indexes in trees
      * @return
@@ -541,6 +563,12 @@ public:
 private:
     void DeserializeFeatures(const NCatBoostFbs::TModelTrees* fbObj);
 
+    /**
+     * Rebuild oblivious trees so that the model contains only the given trees in the given order.
+     * @param treeIndexes indexes of the current trees
+     */
+    void RebuildObliviousTrees(TConstArrayRef<size_t> treeIndexes);
+
     void SetScaleAndBias(const NCatBoostFbs::TModelTrees* fbObj);
 
 
@@ -706,6 +734,24 @@ public:
         UpdateDynamicData();
     }
 
+    /**
+     * Release data that is not used for evaluation: leaf weights and training metadata in ModelInfo
+     * (only loss function, class labels and boosting options needed by predictions are kept).
+     * Useful when many models are kept in memory at once. Feature importances, model sums and exports
+     * that need leaf weights or training parameters are not available for the model afterwards.
+     * @return size in bytes of the dropped leaf weights and ModelInfo keys and values
+     */
+    size_t DropTrainingOnlyData();
+
+    /**
+     * Optional load-time optimization for wide models: reorder trees so that consecutive trees use the same
+     * features. Do not use it if the model is evaluated on tree ranges (staged predictions, truncation).
+     */
+    void ReorderTreesForEvaluation() {
+        ModelTrees.GetMutable()->ReorderTreesForEvaluation();
+        UpdateDynamicData();
+    }
+
     /**
      * @return Minimal float features vector length sufficient for this model
      */
@@ -1021,6 +1067,59 @@ public:
         Calc(floatFeatures, catFeatures, textFeatures, 0, GetTreeCount(), results, featureInfo);
     }
 
+    /**
+     * Binarize objects features with model borders so they can be evaluated multiple times
+     * (on different tree ranges or on different models with the same features quantization)
+     * without repeating binarization.
+     * @param floatFeatures
+     * @param catFeatures vector of vector of TStringBuf with categorical features strings
+     * @return quantized features, pass them to Calc(quantizedFeatures, ...)
+     */
+    TIntrusivePtr<NCB::NModelEvaluation::IQuantizedData> QuantizeFeatures(
+        TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+        TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+        const TFeatureLayout* featureInfo = nullptr
+    ) const;
+
+    /**
+     * Evaluate raw formula predictions on features quantized by QuantizeFeatures of this model
+     * or of a model with the same features quantization (see HasSameFeaturesQuantization).
+     * @param quantizedFeatures
+     * @param treeStart
+     * @param treeEnd
+     * @param results indexation is [objectIndex * ApproxDimension + classId]
+     */
+    void Calc(
+        const NCB::NModelEvaluation::IQuantizedData* quantizedFeatures,
+        size_t treeStart,
+        size_t treeEnd,
+        TArrayRef<double> results
+    ) const;
+
+    /**
+     * Evaluate raw formula values with early exit at tree-range checkpoints. Objects whose partial value passes
+     * checkpoint thresholds are not evaluated on the following trees. Only for one-dimensional models.
+     * @param floatFeatures
+     * @param catFeatures vector of vector of TStringBuf with categorical features strings
+     * @param checkpoints sorted by TreeEnd
+     * @param results raw formula value for each object on the trees evaluated for it
+     * @param evaluatedTreeCounts optional, number of trees evaluated for each object
+     */
+    void CalcCascaded(
+        TConstArrayRef<TConstArrayRef<float>> floatFeatures,
+        TConstArrayRef<TConstArrayRef<TStringBuf>> catFeatures,
+        TConstArrayRef<NCB::NModelEvaluation::TCascadeCheckpoint> checkpoints,
+        TArrayRef<double> results,
+        TArrayRef<ui32> evaluatedTreeCounts = {},
+        const TFeatureLayout* featureInfo = nullptr
+    ) const;
+
+    /**
+     * Check that features quantized by other model can be evaluated by this model:
+     * both models should have the same float borders, one hot values and ctrs.
+     */
+    bool HasSameFeaturesQuantization(const TFullModel& other) const;
+
     /**
      * Truncate model to contain only trees from [begin; end) interval.
      * @param begin
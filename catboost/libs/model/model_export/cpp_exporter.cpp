@@ -5,6 +5,7 @@
 #include <catboost/libs/model/ctr_helpers.h>
 #include <catboost/libs/model/static_ctr_provider.h>
 
+#include <library/cpp/json/json_reader.h>
 #include <library/cpp/resource/resource.h>
 
 #include <util/generic/map.h>
@@ -16,6 +17,32 @@
 namespace NCB {
     using namespace NCatboostModelExportHelpers;
 
+    TCatboostModelToCppConverter::TCatboostModelToCppConverter(
+        const TString& modelFile,
+        bool addFileFormatExtension,
+        const TString& userParametersJson
+    )
+        : Out(modelFile + (addFileFormatExtension ? ".cpp" : ""))
+    {
+        if (userParametersJson.empty()) {
+            return;
+        }
+        NJson::TJsonValue userParameters;
+        CB_ENSURE(NJson::ReadJsonTree(userParametersJson, &userParameters), "Can't parse JSON user params for exporting the model to C++");
+        for (const auto& [name, value] : userParameters.GetMapSafe()) {
+            if (name == "cpp_applier") {
+                const TString& applier = value.GetStringSafe();
+                CB_ENSURE(
+                    applier == "default" || applier == "batched",
+                    "Unknown cpp_applier: " << applier << ", expected \"default\" or \"batched\""
+                );
+                UseBatchedApplier = (applier == "batched");
+            } else {
+                CB_ENSURE(false, "Unsupported JSON user param for exporting the model to C++: " << name);
+            }
+        }
+    }
+
     /*
      * Tiny code for case when cat features not present
      */
@@ -327,6 +354,115 @@ namespace NCB {
         Out << '\n';
     }
 
+    /*
+     * Batched allocation-free applier for models without cat features
+     */
+
+    void TCatboostModelToCppConverter::WriteHeaderBatched() {
+        Out << "#include <cstddef>" << '\n';
+        Out << "#include <limits>" << '\n';
+        Out << "#include <string>" << '\n';
+        Out << "#include <vector>" << '\n';
+        Out << '\n';
+        Out << "/* Define CATBOOST_MODEL_NO_SIMD to disable SSE2/AVX2 code paths */" << '\n';
+        Out << "#if !defined(CATBOOST_MODEL_NO_SIMD)" << '\n';
+        Out << "#if defined(__AVX2__)" << '\n';
+        Out << "#include <immintrin.h>" << '\n';
+        Out << "#define CATBOOST_MODEL_USE_AVX2" << '\n';
+        Out << "#endif" << '\n';
+        Out << "#if defined(__SSE2__) || defined(__AVX2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)" << '\n';
+        Out << "#include <emmintrin.h>" << '\n';
+        Out << "#define CATBOOST_MODEL_USE_SSE2" << '\n';
+        Out << "#endif" << '\n';
+        Out << "#endif" << '\n';
+        Out << '\n';
+    }
+
+    template <class TElementAccessor>
+    static void WriteConstexprArray(
+        IOutputStream& out,
+        TStringBuf type,
+        TStringBuf name,
+        TElementAccessor elementAccessor,
+        size_t size
+    ) {
+        // zero-sized arrays are not allowed, so empty tables get a single unused element
+        out << "static constexpr " << type << " " << name << "[" << Max<size_t>(size, 1) << "] = {";
+        if (size) {
+            out << OutputArrayInitializer(elementAccessor, size);
+        } else {
+            out << "0";
+        }
+        out << "};" << '\n';
+    }
+
+    void TCatboostModelToCppConverter::WriteModelBatched(const TFullModel& model) {
+        CB_ENSURE(model.ModelTrees->GetDimensionsCount() == 1, "Export of MultiClassification model to cpp is not supported.");
+        const auto& trees = *model.ModelTrees;
+
+        TVector<ui32> bucketFloatFeature;
+        TVector<ui32> bucketBorderOffset;
+        TVector<ui32> bucketBorderCount;
+        TVector<float> borders;
+        for (const auto& floatFeature : trees.GetFloatFeatures()) {
+            if (!floatFeature.UsedInModel()) {
+                continue;
+            }
+            for (size_t bucketStart = 0; bucketStart < floatFeature.Borders.size(); bucketStart += MAX_VALUES_PER_BIN) {
+                const size_t bucketEnd = Min(bucketStart + MAX_VALUES_PER_BIN, floatFeature.Borders.size());
+                bucketFloatFeature.push_back(floatFeature.Position.Index);
+                bucketBorderOffset.push_back(borders.size());
+                bucketBorderCount.push_back(bucketEnd - bucketStart);
+                borders.insert(borders.end(), floatFeature.Borders.begin() + bucketStart, floatFeature.Borders.begin() + bucketEnd);
+            }
+        }
+        Y_ASSERT(bucketFloatFeature.size() == trees.GetEffectiveBinaryFeaturesBucketsCount());
+
+        const auto treeSizes = trees.GetModelTreeData()->GetTreeSizes();
+        const auto repackedBins = trees.GetRepackedBins();
+        const auto floatFeatures = trees.GetFloatFeatures();
+
+        Out << "/* Model data */" << '\n';
+        Out << "static constexpr unsigned int CatboostModelFloatFeatureCount = " << model.GetNumFloatFeatures() << ";" << '\n';
+        Out << "static constexpr unsigned int CatboostModelBucketCount = " << bucketFloatFeature.size() << ";" << '\n';
+        Out << "static constexpr unsigned int CatboostModelTreeCount = " << treeSizes.size() << ";" << '\n';
+        Out << '\n';
+        Out << "/* Float features with nan_mode=Max that had NaNs in training: NaN is greater than all borders */" << '\n';
+        WriteConstexprArray(
+            Out, "bool", "CatboostModelFloatFeatureNanAsTrue",
+            [&] (size_t i) {
+                auto it = FindIf(floatFeatures, [i] (const auto& feature) { return feature.Position.Index == (int)i; });
+                return (it != floatFeatures.end() && it->HasNans && it->NanValueTreatment == TFloatFeature::ENanValueTreatment::AsTrue) ? "true" : "false";
+            },
+            model.GetNumFloatFeatures());
+        Out << '\n';
+        Out << "/* Each bucket holds up to " << MAX_VALUES_PER_BIN << " consecutive borders of one float feature */" << '\n';
+        WriteConstexprArray(Out, "unsigned int", "CatboostModelBucketFloatFeature", [&] (size_t i) { return bucketFloatFeature[i]; }, bucketFloatFeature.size());
+        WriteConstexprArray(Out, "unsigned int", "CatboostModelBucketBorderOffset", [&] (size_t i) { return bucketBorderOffset[i]; }, bucketBorderOffset.size());
+        WriteConstexprArray(Out, "unsigned int", "CatboostModelBucketBorderCount", [&] (size_t i) { return bucketBorderCount[i]; }, bucketBorderCount.size());
+        WriteConstexprArray(Out, "float", "CatboostModelBorders", [&] (size_t i) { return FloatToString(borders[i], PREC_NDIGITS, 9); }, borders.size());
+        Out << '\n';
+        Out << "/* Tree splits: object goes right at depth d if its bucket value >= split index */" << '\n';
+        WriteConstexprArray(Out, "unsigned int", "CatboostModelTreeDepth", [&] (size_t i) { return treeSizes[i]; }, treeSizes.size());
+        WriteConstexprArray(Out, "unsigned int", "CatboostModelTreeSplitBucket", [&] (size_t i) { return (ui32)repackedBins[i].FeatureIndex; }, repackedBins.size());
+        WriteConstexprArray(Out, "unsigned char", "CatboostModelTreeSplitIdx", [&] (size_t i) { return (ui32)repackedBins[i].SplitIdx; }, repackedBins.size());
+        Out << '\n';
+        Out << "/* Aggregated array of leaf values for trees. Each tree is represented by a separate line: */" << '\n';
+        Out << "static constexpr double CatboostModelLeafValues[" << Max<size_t>(trees.GetModelTreeData()->GetLeafValues().size(), 1) << "] = {";
+        if (treeSizes.empty()) {
+            Out << "0};" << '\n';
+        } else {
+            Out << OutputLeafValues(model, TIndent(0)) << "};" << '\n';
+        }
+        Out << "static constexpr double CatboostModelScale = " << model.GetScaleAndBias().Scale << ";" << '\n';
+        Out << "static constexpr double CatboostModelBias = " << model.GetScaleAndBias().GetOneDimensionalBias() << ";" << '\n';
+        Out << '\n';
+    }
+
+    void TCatboostModelToCppConverter::WriteApplicatorBatched() {
+        Out << NResource::Find("catboost_model_export_cpp_model_applicator_batched");
+    }
+
     void TCatboostModelToCppConverter::WriteApplicatorCatFeatures() {
         Out << NResource::Find("catboost_model_export_cpp_ctr_calcer");
         Out << '\n';
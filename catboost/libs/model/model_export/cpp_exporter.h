@@ -11,16 +11,21 @@ namespace NCB {
     class TCatboostModelToCppConverter: public ICatboostModelExporter {
     private:
         TOFStream Out;
+        bool UseBatchedApplier = false;
 
     public:
-        TCatboostModelToCppConverter(const TString& modelFile, bool addFileFormatExtension, const TString& userParametersJson)
-            : Out(modelFile + (addFileFormatExtension ? ".cpp" : ""))
-        {
-            CB_ENSURE(userParametersJson.empty(), "JSON user params for exporting the model to C++ are not supported");
-        };
+        TCatboostModelToCppConverter(const TString& modelFile, bool addFileFormatExtension, const TString& userParametersJson);
 
         void Write(const TFullModel& model, const THashMap<ui32, TString>* catFeaturesHashToString = nullptr) override {
-            if (model.HasCategoricalFeatures()) {
+            if (UseBatchedApplier) {
+                CB_ENSURE(
+                    !model.HasCategoricalFeatures(),
+                    "Batched C++ applier is not supported for models with categorical features"
+                );
+                WriteHeaderBatched();
+                WriteModelBatched(model);
+                WriteApplicatorBatched();
+            } else if (model.HasCategoricalFeatures()) {
                 CB_ENSURE(catFeaturesHashToString != nullptr,
                           "need train pool to save mapping {categorical feature value, hash value} "
                           "due to absence of hash function in model");
@@ -41,5 +46,8 @@ namespace NCB {
         void WriteCTRStructs();
         void WriteModelCatFeatures(const TFullModel& model, const THashMap<ui32, TString>* catFeaturesHashToString);
         void WriteApplicatorCatFeatures();
+        void WriteHeaderBatched();
+        void WriteModelBatched(const TFullModel& model);
+        void WriteApplicatorBatched();
     };
 }
@@ -0,0 +1,159 @@
+/* Model applicator */
+static constexpr size_t CatboostModelBlockSize = 128;
+static constexpr size_t CatboostModelBinsSize =
+    (CatboostModelBucketCount > 0 ? CatboostModelBucketCount : 1) * CatboostModelBlockSize;
+
+/* Binarize block of objects: bins[bucket * CatboostModelBlockSize + docId] */
+static inline void CatboostModelBinarizeBlock(
+    const float* features,
+    size_t docCount,
+    unsigned char* bins) {
+    float column[CatboostModelBlockSize];
+    for (unsigned int bucket = 0; bucket < CatboostModelBucketCount; ++bucket) {
+        const unsigned int featureIdx = CatboostModelBucketFloatFeature[bucket];
+        const float nanValue = CatboostModelFloatFeatureNanAsTrue[featureIdx]
+            ? std::numeric_limits<float>::infinity()
+            : -std::numeric_limits<float>::infinity();
+        for (size_t docId = 0; docId < docCount; ++docId) {
+            const float value = features[docId * CatboostModelFloatFeatureCount + featureIdx];
+            column[docId] = (value != value) ? nanValue : value;
+        }
+        const float* borders = CatboostModelBorders + CatboostModelBucketBorderOffset[bucket];
+        const unsigned int borderCount = CatboostModelBucketBorderCount[bucket];
+        unsigned char* bucketBins = bins + bucket * CatboostModelBlockSize;
+        size_t docId = 0;
+#if defined(CATBOOST_MODEL_USE_AVX2)
+        for (; docId + 16 <= docCount; docId += 16) {
+            const __m256 values0 = _mm256_loadu_ps(column + docId);
+            const __m256 values1 = _mm256_loadu_ps(column + docId + 8);
+            __m256i counts0 = _mm256_setzero_si256();
+            __m256i counts1 = _mm256_setzero_si256();
+            for (unsigned int borderIdx = 0; borderIdx < borderCount; ++borderIdx) {
+                const __m256 border = _mm256_set1_ps(borders[borderIdx]);
+                counts0 = _mm256_sub_epi32(counts0, _mm256_castps_si256(_mm256_cmp_ps(values0, border, _CMP_GT_OQ)));
+                counts1 = _mm256_sub_epi32(counts1, _mm256_castps_si256(_mm256_cmp_ps(values1, border, _CMP_GT_OQ)));
+            }
+            const __m128i packed0 = _mm_packs_epi32(_mm256_castsi256_si128(counts0), _mm256_extracti128_si256(counts0, 1));
+            const __m128i packed1 = _mm_packs_epi32(_mm256_castsi256_si128(counts1), _mm256_extracti128_si256(counts1, 1));
+            _mm_storeu_si128((__m128i*)(bucketBins + docId), _mm_packus_epi16(packed0, packed1));
+        }
+#elif defined(CATBOOST_MODEL_USE_SSE2)
+        for (; docId + 16 <= docCount; docId += 16) {
+            const __m128 values0 = _mm_loadu_ps(column + docId);
+            const __m128 values1 = _mm_loadu_ps(column + docId + 4);
+            const __m128 values2 = _mm_loadu_ps(column + docId + 8);
+            const __m128 values3 = _mm_loadu_ps(column + docId + 12);
+            __m128i counts0 = _mm_setzero_si128();
+            __m128i counts1 = _mm_setzero_si128();
+            __m128i counts2 = _mm_setzero_si128();
+            __m128i counts3 = _mm_setzero_si128();
+            for (unsigned int borderIdx = 0; borderIdx < borderCount; ++borderIdx) {
+                const __m128 border = _mm_set1_ps(borders[borderIdx]);
+                counts0 = _mm_sub_epi32(counts0, _mm_castps_si128(_mm_cmpgt_ps(values0, border)));
+                counts1 = _mm_sub_epi32(counts1, _mm_castps_si128(_mm_cmpgt_ps(values1, border)));
+                counts2 = _mm_sub_epi32(counts2, _mm_castps_si128(_mm_cmpgt_ps(values2, border)));
+                counts3 = _mm_sub_epi32(counts3, _mm_castps_si128(_mm_cmpgt_ps(values3, border)));
+            }
+            const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(counts0, counts1), _mm_packs_epi32(counts2, counts3));
+            _mm_storeu_si128((__m128i*)(bucketBins + docId), packed);
+        }
+#endif
+        for (; docId < docCount; ++docId) {
+            unsigned int bin = 0;
+            for (unsigned int borderIdx = 0; borderIdx < borderCount; ++borderIdx) {
+                bin += (unsigned int)(column[docId] > borders[borderIdx]);
+            }
+            bucketBins[docId] = (unsigned char)bin;
+        }
+    }
+}
+
+/* Add values of all trees to results of block of objects */
+static inline void CatboostModelCalcTreesBlock(
+    const unsigned char* bins,
+    size_t docCount,
+    double* results) {
+    unsigned int indexes[CatboostModelBlockSize];
+    const unsigned int* splitBucketPtr = CatboostModelTreeSplitBucket;
+    const unsigned char* splitIdxPtr = CatboostModelTreeSplitIdx;
+    const double* leafValuesPtr = CatboostModelLeafValues;
+    for (unsigned int treeId = 0; treeId < CatboostModelTreeCount; ++treeId) {
+        const unsigned int depth = CatboostModelTreeDepth[treeId];
+        size_t docId = 0;
+#if defined(CATBOOST_MODEL_USE_SSE2)
+        if (depth <= 8) {
+            /* leaf index fits in a byte: process 16 objects at once */
+            for (; docId + 16 <= docCount; docId += 16) {
+                __m128i index = _mm_setzero_si128();
+                for (unsigned int level = 0; level < depth; ++level) {
+                    const __m128i values = _mm_loadu_si128(
+                        (const __m128i*)(bins + splitBucketPtr[level] * CatboostModelBlockSize + docId));
+                    const __m128i split = _mm_set1_epi8((char)splitIdxPtr[level]);
+                    const __m128i goRight = _mm_cmpeq_epi8(_mm_max_epu8(values, split), values);
+                    index = _mm_or_si128(index, _mm_and_si128(goRight, _mm_set1_epi8((char)(1 << level))));
+                }
+                unsigned char byteIndexes[16];
+                _mm_storeu_si128((__m128i*)byteIndexes, index);
+                for (size_t i = 0; i < 16; ++i) {
+                    indexes[docId + i] = byteIndexes[i];
+                }
+            }
+        }
+#endif
+        for (size_t tailDocId = docId; tailDocId < docCount; ++tailDocId) {
+            indexes[tailDocId] = 0;
+        }
+        for (unsigned int level = 0; level < depth; ++level) {
+            const unsigned char* levelBins = bins + splitBucketPtr[level] * CatboostModelBlockSize;
+            const unsigned char split = splitIdxPtr[level];
+            for (size_t tailDocId = docId; tailDocId < docCount; ++tailDocId) {
+                indexes[tailDocId] |= (unsigned int)(levelBins[tailDocId] >= split) << level;
+            }
+        }
+        for (size_t i = 0; i < docCount; ++i) {
+            results[i] += leafValuesPtr[indexes[i]];
+        }
+        splitBucketPtr += depth;
+        splitIdxPtr += depth;
+        leafValuesPtr += (size_t)1 << depth;
+    }
+}
+
+/*
+ * Batched model applicator, doesn't allocate memory.
+ * features: row-major array of docCount * CatboostModelFloatFeatureCount float features
+ * results: array of docCount raw predictions
+ */
+void ApplyCatboostModelBatch(
+    const float* features,
+    size_t docCount,
+    double* results) {
+    static thread_local unsigned char bins[CatboostModelBinsSize];
+    for (size_t blockStart = 0; blockStart < docCount; blockStart += CatboostModelBlockSize) {
+        const size_t blockDocCount =
+            docCount - blockStart < CatboostModelBlockSize ? docCount - blockStart : CatboostModelBlockSize;
+        double* blockResults = results + blockStart;
+        CatboostModelBinarizeBlock(features + blockStart * CatboostModelFloatFeatureCount, blockDocCount, bins);
+        for (size_t docId = 0; docId < blockDocCount; ++docId) {
+            blockResults[docId] = 0.0;
+        }
+        CatboostModelCalcTreesBlock(bins, blockDocCount, blockResults);
+        for (size_t docId = 0; docId < blockDocCount; ++docId) {
+            blockResults[docId] = CatboostModelScale * blockResults[docId] + CatboostModelBias;
+        }
+    }
+}
+
+double ApplyCatboostModel(
+    const std::vector<float>& features) {
+    double result = 0.0;
+    ApplyCatboostModelBatch(features.data(), 1, &result);
+    return result;
+}
+
+// Also emit the API with catFeatures, for uniformity
+double ApplyCatboostModel(
+    const std::vector<float>& floatFeatures,
+    const std::vector<std::string>&) {
+    return ApplyCatboostModel(floatFeatures);
+}
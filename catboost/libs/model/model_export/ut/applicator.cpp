@@ -91,6 +91,11 @@ static void ParseFeatures(
 
 extern double ApplyCatboostModel(const vector<float>& floatFeatures, const vector<string>& catFeatures);
 
+#if defined(APPLICATOR_BATCHED)
+// models exported with cpp_applier=batched, the whole file is applied in one call
+extern void ApplyCatboostModelBatch(const float* features, size_t docCount, double* results);
+#endif
+
 int main(int argc, char *argv[]) {
     assert(argc == 4);  // main.exe test.tsv cd.tsv predictions.txt
 
@@ -104,6 +109,8 @@ int main(int argc, char *argv[]) {
     ofstream predictions(argv[3]);
     predictions << setprecision(10);
     string line;
+    vector<float> allFloatFeatures;
+    vector<double> rawFormulaVals;
     for (size_t docId = 0; getline(test, line); ++docId) {
         vector<float> floatFeatures;
         vector<string> catFeatures;
@@ -115,12 +122,22 @@ int main(int argc, char *argv[]) {
         }
         ParseFeatures(line, floatColumns, catColumns, &floatFeatures, &catFeatures);
 
-        double rawFormulaVal = ApplyCatboostModel(floatFeatures, catFeatures);
+#if defined(APPLICATOR_BATCHED)
+        allFloatFeatures.insert(allFloatFeatures.end(), floatFeatures.begin(), floatFeatures.end());
+        rawFormulaVals.push_back(0.0);
+#else
+        rawFormulaVals.push_back(ApplyCatboostModel(floatFeatures, catFeatures));
+#endif
+    }
+#if defined(APPLICATOR_BATCHED)
+    ApplyCatboostModelBatch(allFloatFeatures.data(), rawFormulaVals.size(), rawFormulaVals.data());
+#endif
 
+    for (size_t docId = 0; docId < rawFormulaVals.size(); ++docId) {
         if (docId == 0) {
             predictions << "SampleId" << DELIMITER << "RawFormulaVal" << endl;
         }
-        predictions << docId << DELIMITER << rawFormulaVal << endl;
+        predictions << docId << DELIMITER << rawFormulaVals[docId] << endl;
     }
 
     return 0;
@@ -92,6 +92,87 @@ def test_cpp_export(dataset, parameters):
             raise
 
 
+def _has_avx2():
+    try:
+        with open('/proc/cpuinfo') as cpuinfo:
+            return ' avx2' in cpuinfo.read()
+    except IOError:
+        return False
+
+
+# more than 254 borders per feature are split into several bin buckets
+@pytest.mark.parametrize('border_count', [254, 1024])
+@pytest.mark.parametrize('simd', ['default', 'avx2', 'no_simd'])
+def test_cpp_export_batched(simd, border_count):
+    if simd == 'avx2' and not (os.name == 'posix' and _has_avx2()):
+        pytest.skip('AVX2 is not available')
+
+    train_pool, _ = _get_train_test_pool('higgs')
+    train_path, test_small_path, cd_path = _get_train_test_cd_path('higgs')
+
+    # more than one block of 128 objects, so that SIMD binarization loops and the tail both run,
+    # and NaNs that training data doesn't have: nan_mode=Max must then be ignored like in the library
+    test_path = yatest.common.test_output_path('test_batched')
+    with open(test_path, 'w') as test_file:
+        for input_path in (train_path, test_small_path):
+            with open(input_path) as input_file:
+                for line_idx, line in enumerate(input_file):
+                    values = line.rstrip('\n').split('\t')
+                    if line_idx % 3 == 0:
+                        values[1 + line_idx % (len(values) - 1)] = 'nan'
+                    test_file.write('\t'.join(values) + '\n')
+
+    model = CatBoost({
+        'iterations': 100,
+        'random_seed': 0,
+        'loss_function': 'Logloss',
+        'border_count': border_count,
+        'nan_mode': 'Max',
+    })
+    model.fit(train_pool)
+    model_cpp = yatest.common.test_output_path('model.cpp')
+    model_cbm = yatest.common.test_output_path('model.bin')
+    model.save_model(model_cpp, format='cpp', export_parameters={'cpp_applier': 'batched'})
+    model.save_model(model_cbm)
+
+    applicator_cpp = yatest.common.source_path('catboost/libs/model/model_export/ut/applicator.cpp')
+    applicator_exe = yatest.common.test_output_path('applicator.exe')
+    predictions_by_catboost_path = yatest.common.test_output_path('predictions_by_catboost.txt')
+    predictions_path = yatest.common.test_output_path('predictions.txt')
+
+    if os.name == 'posix':
+        compile_cmd = ['g++', '-std=c++14', '-O2', '-o', applicator_exe]
+        simd_flags = {'default': [], 'avx2': ['-mavx2'], 'no_simd': ['-DCATBOOST_MODEL_NO_SIMD']}
+    else:
+        compile_cmd = ['cl.exe', '-O2', '-Fe' + applicator_exe]
+        simd_flags = {'default': [], 'no_simd': ['-DCATBOOST_MODEL_NO_SIMD']}
+    compile_cmd += simd_flags[simd] + ['-DAPPLICATOR_BATCHED', applicator_cpp, model_cpp]
+    apply_cmd = [applicator_exe, test_path, cd_path, predictions_path]
+    calc_cmd = [CATBOOST_APP_PATH, 'calc',
+                '-m', model_cbm,
+                '--input-path', test_path,
+                '--cd', cd_path,
+                '--output-path', predictions_by_catboost_path,
+                ]
+    compare_cmd = [APPROXIMATE_DIFF_PATH,
+                   '--have-header',
+                   '--diff-limit', '1e-6',
+                   predictions_path,
+                   predictions_by_catboost_path,
+                   ]
+
+    try:
+        yatest.common.execute(compile_cmd)
+        yatest.common.execute(apply_cmd)
+        yatest.common.execute(calc_cmd)
+        yatest.common.execute(compare_cmd)
+    except OSError as e:
+        if re.search(r"No such file or directory.*'{}'".format(re.escape(compile_cmd[0])), str(e)):
+            pytest.xfail(reason='We ignore `compiler not found` error: {}\n'.format(str(e)))
+        else:
+            raise
+
+
 def test_read_model_after_train():
     train_path, test_path, cd_path = _get_train_test_cd_path('adult')
     eval_file = yatest.common.test_output_path('eval-file')
@@ -8,6 +8,11 @@
 
 #include <library/cpp/testing/unittest/registar.h>
 
+#include <util/generic/algorithm.h>
+#include <util/random/fast.h>
+
+#include <utility>
+
 using namespace NCB;
 using namespace NCB::NModelEvaluation;
 
@@ -32,6 +37,20 @@ TVector<TConstArrayRef<float>> GetFeatureRef(const TVector<TVector<float>>& data
 
 const auto FLOAT_FEATURES = GetFeatureRef(DATA);
 
+// objects for models returned by TrainCatOnlyModel
+const TVector<TVector<TStringBuf>> CAT_ONLY_DATA = {{"a", "b", "c"}, {"d", "e", "f"}, {"g", "h", "k"}};
+
+TVector<TVector<float>> GenerateRandomData(size_t docCount, ui64 seed = 0) {
+    TFastRng64 rng(seed);
+    TVector<TVector<float>> data(docCount, TVector<float>(3));
+    for (auto& doc : data) {
+        for (auto& value : doc) {
+            value = rng.GenRandReal1();
+        }
+    }
+    return data;
+}
+
 void CheckFlatCalcResult(
     const TFullModel& model,
     const TVector<double>& expectedPredicts,
@@ -154,13 +173,288 @@ Y_UNIT_TEST_SUITE(TObliviousTreeModel) {
         UNIT_ASSERT_NO_EXCEPTION(applySingle());
 
         const auto applyBatch = [&] {
-            const TVector<TStringBuf> f[] = {{"a", "b", "c"}, {"d", "e", "f"}, {"g", "h", "k"}};
             double results[3];
-            model.Calc({}, f, results);
+            model.Calc({}, CAT_ONLY_DATA, results);
         };
         UNIT_ASSERT_NO_EXCEPTION(applyBatch());
     }
 
+    Y_UNIT_TEST(TestRepeatedCalcWithDifferentBatchSizes) {
+        const auto model = TrainCatOnlyModel();
+
+        double batchResults[3];
+        model.Calc({}, CAT_ONLY_DATA, batchResults);
+        for (size_t docId : xrange(3)) {
+            double result = 0.;
+            model.Calc({}, MakeArrayRef(CAT_ONLY_DATA.data() + docId, 1), MakeArrayRef(&result, 1));
+            UNIT_ASSERT_DOUBLES_EQUAL(batchResults[docId], result, 1e-9);
+        }
+        double repeatedBatchResults[3];
+        model.Calc({}, CAT_ONLY_DATA, repeatedBatchResults);
+        for (size_t docId : xrange(3)) {
+            UNIT_ASSERT_VALUES_EQUAL(batchResults[docId], repeatedBatchResults[docId]);
+        }
+    }
+
+    Y_UNIT_TEST(TestWarmCalcKeepsBuffers) {
+        const auto model = TrainCatOnlyModel();
+
+        double results[3];
+        model.Calc({}, CAT_ONLY_DATA, results);
+
+        const auto& argumentBuffers = TCalcArgumentBuffers::GetThreadLocal();
+        const auto& scratchBuffers = GetThreadLocalScratchBuffers();
+        const auto getBuffersState = [&] {
+            return TVector<std::pair<const void*, size_t>>{
+                {argumentBuffers.CatFeatureStringRefs.data(), argumentBuffers.CatFeatureStringRefs.capacity()},
+                {scratchBuffers.QuantizedData.data(), scratchBuffers.QuantizedData.capacity()},
+                {scratchBuffers.TransposedHash.data(), scratchBuffers.TransposedHash.capacity()},
+                {scratchBuffers.Ctrs.data(), scratchBuffers.Ctrs.capacity()},
+                {scratchBuffers.Indexes.data(), scratchBuffers.Indexes.capacity()}
+            };
+        };
+        const auto warmState = getBuffersState();
+
+        // warm calls of the same size reuse the buffers instead of allocating new ones
+        for (auto i : xrange(3)) {
+            Y_UNUSED(i);
+            model.Calc({}, CAT_ONLY_DATA, results);
+            UNIT_ASSERT(getBuffersState() == warmState);
+        }
+
+        // large batches use temporary argument buffers, so thread-local ones do not grow
+        const TVector<TVector<TStringBuf>> largeBatch(TCalcArgumentBuffers::MaxObjectCountForThreadLocalBuffers + 1, CAT_ONLY_DATA[0]);
+        TVector<double> largeBatchResults(largeBatch.size());
+        model.Calc({}, largeBatch, largeBatchResults);
+        UNIT_ASSERT_VALUES_EQUAL(argumentBuffers.CatFeatureStringRefs.capacity(), warmState[0].second);
+        UNIT_ASSERT_DOUBLES_EQUAL(largeBatchResults.back(), results[0], 1e-9);
+    }
+
+    Y_UNIT_TEST(TestCatFeatureHashCache) {
+        const TString storage = "abcabc";
+        const TStringBuf values[] = {
+            TStringBuf(storage).substr(0, 3),
+            TStringBuf(storage).substr(0, 3),
+            TStringBuf(storage).substr(3, 3), // same value at another address
+            TStringBuf(storage).substr(0, 2), // same address, another value
+            TStringBuf(storage).substr(0, 3),
+            TStringBuf(),
+            TStringBuf(storage).substr(0, 0)
+        };
+        TVector<ui32> hashes(Y_ARRAY_SIZE(values));
+        CalcCatFeatureHashes(values, hashes);
+        for (size_t i : xrange(hashes.size())) {
+            UNIT_ASSERT_VALUES_EQUAL(hashes[i], CalcCatFeatureHash(values[i]));
+        }
+
+        const auto model = TrainCatOnlyModel();
+        const TVector<TStringBuf> f[] = {{"a", "b", "c"}, {"a", "b", "c"}, {"d", "b", "f"}, {"a", "e", "c"}};
+        double batchResults[4];
+        model.Calc({}, f, batchResults);
+        for (size_t docId : xrange(4)) {
+            double result = 0.;
+            model.Calc({}, MakeArrayRef(f + docId, 1), MakeArrayRef(&result, 1));
+            UNIT_ASSERT_DOUBLES_EQUAL(batchResults[docId], result, 1e-9);
+        }
+    }
+
+    Y_UNIT_TEST(TestCalcOnQuantizedFeatures) {
+        const auto model = TrainCatOnlyModel();
+        const TVector<TConstArrayRef<TStringBuf>> catFeatures(CAT_ONLY_DATA.begin(), CAT_ONLY_DATA.end());
+        const size_t treeCount = model.GetTreeCount();
+        const size_t middle = treeCount / 2;
+
+        auto quantizedFeatures = model.QuantizeFeatures({}, catFeatures);
+        UNIT_ASSERT_VALUES_EQUAL(quantizedFeatures->GetObjectsCount(), 3);
+        UNIT_ASSERT(model.HasSameFeaturesQuantization(model));
+
+        const std::pair<size_t, size_t> treeRanges[] = {{0, treeCount}, {0, middle}, {middle, treeCount}};
+        for (const auto& [treeStart, treeEnd] : treeRanges) {
+            TVector<double> expected(3);
+            model.Calc({}, CAT_ONLY_DATA, treeStart, treeEnd, expected);
+            TVector<double> results(3);
+            model.Calc(quantizedFeatures.Get(), treeStart, treeEnd, results);
+            for (size_t docId : xrange(3)) {
+                UNIT_ASSERT_DOUBLES_EQUAL(expected[docId], results[docId], 1e-9);
+            }
+        }
+    }
+
+    Y_UNIT_TEST(TestCalcTreeRangeBinarizesOnlyUsedFeatures) {
+        const auto model = TrainFloatCatboostModel(/*iterations*/ 20);
+        const size_t treeCount = model.GetTreeCount();
+        const auto data = GenerateRandomData(300);
+        const auto features = GetFeatureRef(data);
+
+        const std::pair<size_t, size_t> treeRanges[] = {{0, 1}, {3, 4}, {5, 12}, {treeCount - 1, treeCount}};
+        for (size_t docCount : {size_t(1), data.size()}) {
+            const auto docFeatures = MakeConstArrayRef(features).first(docCount);
+            // QuantizeFeatures binarizes all features of the model, so it is the reference for pruned binarization
+            const auto quantizedFeatures = model.QuantizeFeatures(docFeatures, {});
+            for (const auto& [treeStart, treeEnd] : treeRanges) {
+                TVector<double> expected(docCount);
+                model.Calc(quantizedFeatures.Get(), treeStart, treeEnd, expected);
+                TVector<double> results(docCount);
+                model.Calc(docFeatures, TConstArrayRef<TConstArrayRef<int>>(), treeStart, treeEnd, results);
+                for (size_t docId : xrange(docCount)) {
+                    UNIT_ASSERT_DOUBLES_EQUAL(expected[docId], results[docId], 1e-9);
+                }
+            }
+        }
+    }
+
+    Y_UNIT_TEST(TestCalcTreeRangeOnCtrModel) {
+        const auto model = TrainFloatAndCatModel();
+        const size_t treeCount = model.GetTreeCount();
+        // projections with float splits make tree range evaluation binarize all non-ctr features
+        UNIT_ASSERT(AnyOf(
+            model.ModelTrees->GetUsedModelCtrs(),
+            [] (const TModelCtr& ctr) { return !ctr.Base.Projection.BinFeatures.empty(); }
+        ));
+
+        TVector<TVector<float>> floatData;
+        TVector<TVector<TStringBuf>> catData;
+        GenerateFloatAndCatData(300, /*seed*/ 1, &floatData, &catData);
+        const auto floatFeatures = GetFeatureRef(floatData);
+        const TVector<TConstArrayRef<TStringBuf>> catFeatures(catData.begin(), catData.end());
+
+        TVector<std::pair<size_t, size_t>> treeRanges = {{0, treeCount / 2}, {treeCount / 2, treeCount}};
+        for (size_t treeIdx : xrange(treeCount)) {
+            treeRanges.emplace_back(treeIdx, treeIdx + 1);
+        }
+        for (size_t docCount : {size_t(1), floatData.size()}) {
+            const auto docFloatFeatures = MakeConstArrayRef(floatFeatures).first(docCount);
+            const auto docCatFeatures = MakeConstArrayRef(catFeatures).first(docCount);
+            const auto quantizedFeatures = model.QuantizeFeatures(docFloatFeatures, docCatFeatures);
+            TVector<ui32> allLeafIndexes(docCount * treeCount);
+            model.CalcLeafIndexes(docFloatFeatures, docCatFeatures, allLeafIndexes);
+            // second pass takes features to binarize from the evaluator cache
+            for (size_t pass = 0; pass < 2; ++pass) {
+                for (const auto& [treeStart, treeEnd] : treeRanges) {
+                    TVector<double> expected(docCount);
+                    model.Calc(quantizedFeatures.Get(), treeStart, treeEnd, expected);
+                    TVector<double> results(docCount);
+                    model.Calc(
+                        docFloatFeatures,
+                        MakeConstArrayRef(catData).first(docCount),
+                        treeStart,
+                        treeEnd,
+                        results
+                    );
+                    for (size_t docId : xrange(docCount)) {
+                        UNIT_ASSERT_DOUBLES_EQUAL(expected[docId], results[docId], 1e-9);
+                    }
+
+                    const size_t rangeSize = treeEnd - treeStart;
+                    TVector<ui32> leafIndexes(docCount * rangeSize);
+                    model.CalcLeafIndexes(docFloatFeatures, docCatFeatures, treeStart, treeEnd, leafIndexes);
+                    for (size_t docId : xrange(docCount)) {
+                        for (size_t treeIdx : xrange(rangeSize)) {
+                            UNIT_ASSERT_VALUES_EQUAL(
+                                allLeafIndexes[docId * treeCount + treeStart + treeIdx],
+                                leafIndexes[docId * rangeSize + treeIdx]
+                            );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    Y_UNIT_TEST(TestCascadedCalc) {
+        const auto model = TrainFloatCatboostModel(/*iterations*/ 20);
+        const size_t treeCount = model.GetTreeCount();
+        for (size_t docCount : {1, 300}) {
+            const auto data = GenerateRandomData(docCount, /*seed*/ docCount);
+            const auto features = GetFeatureRef(data);
+
+            const size_t checkpointTreeEnds[] = {5, 10};
+            TVector<TVector<double>> partialValues;
+            TVector<TCascadeCheckpoint> checkpoints;
+            for (size_t treeEnd : checkpointTreeEnds) {
+                partialValues.emplace_back(docCount);
+                model.CalcFlat(features, 0, treeEnd, partialValues.back());
+                auto sorted = partialValues.back();
+                Sort(sorted);
+                checkpoints.push_back({treeEnd, sorted[docCount / 4], sorted[docCount * 3 / 4]});
+            }
+            TVector<double> fullValues(docCount);
+            model.CalcFlat(features, fullValues);
+
+            TVector<double> results(docCount);
+            TVector<ui32> evaluatedTreeCounts(docCount);
+            model.CalcCascaded(features, {}, checkpoints, results, evaluatedTreeCounts);
+            for (size_t docId : xrange(docCount)) {
+                double expectedValue = fullValues[docId];
+                size_t expectedTreeCount = treeCount;
+                for (size_t checkpointId : xrange(checkpoints.size())) {
+                    const double value = partialValues[checkpointId][docId];
+                    if (value <= checkpoints[checkpointId].LowerThreshold || value >= checkpoints[checkpointId].UpperThreshold) {
+                        expectedValue = value;
+                        expectedTreeCount = checkpoints[checkpointId].TreeEnd;
+                        break;
+                    }
+                }
+                UNIT_ASSERT_DOUBLES_EQUAL(expectedValue, results[docId], 1e-9);
+                UNIT_ASSERT_VALUES_EQUAL(expectedTreeCount, evaluatedTreeCounts[docId]);
+            }
+
+            // without checkpoints cascaded evaluation is the usual one
+            model.CalcCascaded(features, {}, {}, results);
+            for (size_t docId : xrange(docCount)) {
+                UNIT_ASSERT_DOUBLES_EQUAL(fullValues[docId], results[docId], 1e-9);
+            }
+        }
+    }
+
+    Y_UNIT_TEST(TestReorderTreesForEvaluation) {
+        const auto model = TrainFloatCatboostModel(/*iterations*/ 20);
+        const auto order = model.ModelTrees->GetTreesOrderForEvaluation();
+        UNIT_ASSERT_VALUES_EQUAL(order.size(), model.GetTreeCount());
+        auto sortedOrder = order;
+        Sort(sortedOrder);
+        for (size_t treeIdx : xrange(sortedOrder.size())) {
+            UNIT_ASSERT_VALUES_EQUAL(sortedOrder[treeIdx], treeIdx);
+        }
+
+        auto reorderedModel = model;
+        reorderedModel.ReorderTreesForEvaluation();
+        UNIT_ASSERT_VALUES_EQUAL(model.GetTreeCount(), reorderedModel.GetTreeCount());
+        const auto reorderedOrder = reorderedModel.ModelTrees->GetTreesOrderForEvaluation();
+        UNIT_ASSERT(IsSorted(reorderedOrder.begin(), reorderedOrder.end()));
+
+        const auto data = GenerateRandomData(300);
+        const auto features = GetFeatureRef(data);
+        TVector<double> expected(data.size());
+        model.CalcFlat(features, expected);
+        TVector<double> results(data.size());
+        reorderedModel.CalcFlat(features, results);
+        for (size_t docId : xrange(data.size())) {
+            UNIT_ASSERT_DOUBLES_EQUAL(expected[docId], results[docId], 1e-9);
+        }
+    }
+
+    Y_UNIT_TEST(TestSameFeaturesQuantization) {
+        const auto model = TrainFloatCatboostModel();
+        UNIT_ASSERT(model.HasSameFeaturesQuantization(model));
+
+        TFullModel modelCopy = model;
+        modelCopy.ModelTrees.GetMutable();
+        modelCopy.UpdateDynamicData();
+        UNIT_ASSERT(model.HasSameFeaturesQuantization(modelCopy));
+
+        // nan values are binarized differently, so quantized data is not interchangeable
+        TFullModel modelWithOtherNans = model;
+        TVector<TFloatFeature> floatFeatures(
+            model.ModelTrees->GetFloatFeatures().begin(),
+            model.ModelTrees->GetFloatFeatures().end());
+        floatFeatures[0].HasNans = !floatFeatures[0].HasNans;
+        modelWithOtherNans.ModelTrees.GetMutable()->SetFloatFeatures(floatFeatures);
+        modelWithOtherNans.UpdateDynamicData();
+        UNIT_ASSERT(!model.HasSameFeaturesQuantization(modelWithOtherNans));
+        UNIT_ASSERT(!modelWithOtherNans.HasSameFeaturesQuantization(model));
+    }
+
     static void CheckCalcTextResult(
         const TFullModel& model,
         TConstArrayRef<TVector<TStringBuf>> transposedTextFeatures,
@@ -8,6 +8,8 @@
 
 #include <library/cpp/json/json_value.h>
 
+#include <util/generic/xrange.h>
+#include <util/random/fast.h>
 #include <util/string/builder.h>
 #include <util/folder/tempdir.h>
 
@@ -477,3 +479,97 @@ TFullModel MultiValueFloatModel() {
     model.UpdateDynamicData();
     return model;
 }
+
+static const TStringBuf FLOAT_AND_CAT_MODEL_CAT_VALUES[] = {"a", "b", "c", "d", "e"};
+
+void GenerateFloatAndCatData(
+    size_t docCount,
+    ui64 seed,
+    TVector<TVector<float>>* floatFeatures,
+    TVector<TVector<TStringBuf>>* catFeatures
+) {
+    TFastRng64 rng(seed);
+    floatFeatures->assign(docCount, TVector<float>(2));
+    catFeatures->assign(docCount, TVector<TStringBuf>(2));
+    for (auto docId : xrange(docCount)) {
+        for (auto& value : (*floatFeatures)[docId]) {
+            value = rng.GenRandReal1();
+        }
+        for (auto& value : (*catFeatures)[docId]) {
+            value = FLOAT_AND_CAT_MODEL_CAT_VALUES[rng.Uniform(Y_ARRAY_SIZE(FLOAT_AND_CAT_MODEL_CAT_VALUES))];
+        }
+    }
+}
+
+TFullModel TrainFloatAndCatModel(int iterations) {
+    const ui32 docCount = 5000;
+    TVector<TVector<float>> floatFeatures;
+    TVector<TVector<TStringBuf>> catFeatures;
+    GenerateFloatAndCatData(docCount, /*seed*/ 0, &floatFeatures, &catFeatures);
+
+    TDataProviders dataProviders;
+    dataProviders.Learn = CreateDataProvider(
+        [&] (IRawFeaturesOrderDataVisitor* visitor) {
+            TDataMetaInfo metaInfo;
+            metaInfo.TargetType = ERawTargetType::Float;
+            metaInfo.TargetCount = 1;
+            metaInfo.FeaturesLayout = MakeIntrusive<TFeaturesLayout>(
+                (ui32)4,
+                TVector<ui32>{2, 3},
+                TVector<ui32>{},
+                TVector<ui32>{},
+                TVector<TString>{});
+
+            visitor->Start(metaInfo, docCount, EObjectsOrder::Undefined, {});
+
+            for (auto factorId : xrange(2)) {
+                TVector<float> vec(docCount);
+                TVector<TStringBuf> catVec(docCount);
+                for (auto docId : xrange(docCount)) {
+                    vec[docId] = floatFeatures[docId][factorId];
+                    catVec[docId] = catFeatures[docId][factorId];
+                }
+                visitor->AddFloatFeature(
+                    factorId,
+                    MakeIntrusive<TTypeCastArrayHolder<float, float>>(std::move(vec))
+                );
+                visitor->AddCatFeature(2 + factorId, TConstArrayRef<TStringBuf>(catVec));
+            }
+
+            // the effect of the categorical feature depends on the float feature, so trees need combinations
+            TVector<float> target(docCount);
+            for (auto docId : xrange(docCount)) {
+                const bool isHigh = floatFeatures[docId][0] > 0.5f;
+                const bool isFirstValues = catFeatures[docId][0] < TStringBuf("c");
+                target[docId] = (isHigh == isFirstValues ? 1.0f : 0.0f) + 0.1f * floatFeatures[docId][1];
+            }
+            visitor->AddTarget(MakeIntrusive<TTypeCastArrayHolder<float, float>>(std::move(target)));
+
+            visitor->Finish();
+        }
+    );
+    dataProviders.Test.push_back(dataProviders.Learn);
+
+    TTempDir trainDir;
+    TFullModel model;
+    TEvalResult evalResult;
+    NJson::TJsonValue params;
+    params.InsertValue("iterations", iterations);
+    params.InsertValue("random_seed", 1);
+    params.InsertValue("train_dir", trainDir.Name());
+    params.InsertValue("one_hot_max_size", 0);
+    TrainModel(
+        params,
+        nullptr,
+        {},
+        {},
+        std::move(dataProviders),
+        /*initModel*/ Nothing(),
+        /*initLearnProgress*/ nullptr,
+        "",
+        &model,
+        {&evalResult}
+    );
+
+    return model;
+}
@@ -28,4 +28,15 @@ TFullModel MultiValueFloatModel();
 // Deterministically train model that has only 3 categorical features.
 TFullModel TrainCatOnlyModel();
 
-TFullModel TrainCatOnlyNoOneHotModel();
\ No newline at end of file
+TFullModel TrainCatOnlyNoOneHotModel();
+
+// Deterministically train model on 2 float and 2 categorical features, ctrs of the model combine
+// categorical features with float feature splits. Objects are generated by GenerateFloatAndCatData.
+TFullModel TrainFloatAndCatModel(int iterations = 20);
+
+void GenerateFloatAndCatData(
+    size_t docCount,
+    ui64 seed,
+    TVector<TVector<float>>* floatFeatures,
+    TVector<TVector<TStringBuf>>* catFeatures
+);
@@ -0,0 +1,66 @@
+#include <catboost/libs/model/cpu/quantization.h>
+
+#include <library/cpp/testing/unittest/registar.h>
+
+#include <util/generic/algorithm.h>
+#include <util/generic/vector.h>
+#include <util/random/fast.h>
+
+#include <limits>
+
+using namespace NCB::NModelEvaluation;
+
+template <bool UseNanSubstitution>
+static void CheckBinarySearchBinarization(size_t borderCount, size_t docCount, float nanSubstitutionValue) {
+    TFastRng64 rng(borderCount * 1000 + docCount);
+    TVector<float> borders(borderCount);
+    for (auto& border : borders) {
+        border = rng.GenRandReal1() * 200.0f - 100.0f;
+    }
+    Sort(borders);
+
+    TVector<float> values(docCount);
+    for (size_t docId = 0; docId < docCount; ++docId) {
+        switch (docId % 5) {
+            case 0:
+                values[docId] = std::numeric_limits<float>::quiet_NaN();
+                break;
+            case 1:
+                values[docId] = borders[rng.Uniform(borderCount)];
+                break;
+            default:
+                values[docId] = rng.GenRandReal1() * 240.0f - 120.0f;
+                break;
+        }
+    }
+    const auto accessor = [&values](TFeaturePosition, size_t index) {
+        return values[index];
+    };
+
+    const size_t bucketCount = (borderCount + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN;
+    TVector<ui8> linear(bucketCount * docCount, 0);
+    TVector<ui8> binarySearch(bucketCount * docCount, 0);
+    ui8* linearPtr = linear.data();
+    ui8* binarySearchPtr = binarySearch.data();
+    BinarizeFloatsLinear<UseNanSubstitution>(
+        TFeaturePosition(), docCount, accessor, borders, 0, linearPtr, nanSubstitutionValue);
+    BinarizeFloatsBinarySearch<UseNanSubstitution>(
+        TFeaturePosition(), docCount, accessor, borders, 0, binarySearchPtr, nanSubstitutionValue);
+
+    UNIT_ASSERT_EQUAL(linearPtr, linear.data() + linear.size());
+    UNIT_ASSERT_EQUAL(binarySearchPtr, binarySearch.data() + binarySearch.size());
+    UNIT_ASSERT_EQUAL(linear, binarySearch);
+}
+
+Y_UNIT_TEST_SUITE(TFloatBinarization) {
+    Y_UNIT_TEST(BinarySearchMatchesLinear) {
+        const float infinity = std::numeric_limits<float>::infinity();
+        for (size_t borderCount : TVector<size_t>{1, 2, 15, 64, 254, 255, 300, 1024}) {
+            for (size_t docCount : TVector<size_t>{1, 37, FORMULA_EVALUATION_BLOCK_SIZE}) {
+                CheckBinarySearchBinarization<false>(borderCount, docCount, 0.0f);
+                CheckBinarySearchBinarization<true>(borderCount, docCount, -infinity);
+                CheckBinarySearchBinarization<true>(borderCount, docCount, infinity);
+            }
+        }
+    }
+}
@@ -52,4 +52,50 @@ Y_UNIT_TEST_SUITE(TShrinkModel) {
         }
         model.Truncate(1, 3);
     }
+
+    Y_UNIT_TEST(TestDropTrainingOnlyData) {
+        NJson::TJsonValue params;
+        params.InsertValue("learning_rate", 0.3);
+        params.InsertValue("iterations", 5);
+        params.InsertValue("loss_function", "Logloss");
+        TFullModel model;
+        TEvalResult evalResult;
+
+        TDataProviderPtr pool = GetAdultPool();
+
+        TrainModel(
+            params,
+            nullptr,
+            Nothing(),
+            Nothing(),
+            TDataProviders{pool, {pool}},
+            /*initModel*/ Nothing(),
+            /*initLearnProgress*/ nullptr,
+            "",
+            &model,
+            {&evalResult});
+
+        const size_t leafWeightsSize = model.ModelTrees->GetModelTreeData()->GetLeafWeights().size() * sizeof(double);
+        auto compactModel = model;
+        const size_t droppedSize = compactModel.DropTrainingOnlyData();
+        UNIT_ASSERT_GT(droppedSize, leafWeightsSize);
+        // serialized model stores both leaf weights and ModelInfo, so it shrinks by about the dropped size
+        const size_t serializedSize = SerializeModel(model).size();
+        const size_t compactSerializedSize = SerializeModel(compactModel).size();
+        UNIT_ASSERT_LT(compactSerializedSize + leafWeightsSize, serializedSize);
+        UNIT_ASSERT_LE(serializedSize - compactSerializedSize, droppedSize + droppedSize / 10);
+        UNIT_ASSERT_VALUES_EQUAL(compactModel.DropTrainingOnlyData(), 0);
+        UNIT_ASSERT(compactModel.ModelTrees->GetModelTreeData()->GetLeafWeights().empty());
+        UNIT_ASSERT(!model.ModelTrees->GetModelTreeData()->GetLeafWeights().empty());
+        UNIT_ASSERT(!compactModel.ModelInfo.contains("train_finish_time"));
+        UNIT_ASSERT_VALUES_EQUAL(compactModel.GetLossFunctionName(), model.GetLossFunctionName());
+        UNIT_ASSERT_VALUES_EQUAL(compactModel.GetModelClassLabels().size(), model.GetModelClassLabels().size());
+
+        auto result = ApplyModelMulti(model, *(pool->ObjectsData))[0];
+        auto compactResult = ApplyModelMulti(compactModel, *(pool->ObjectsData))[0];
+        UNIT_ASSERT_EQUAL(result.ysize(), compactResult.ysize());
+        for (int idx = 0; idx < result.ysize(); ++idx) {
+            UNIT_ASSERT_VALUES_EQUAL(result[idx], compactResult[idx]);
+        }
+    }
 }
@@ -14,6 +14,11 @@ struct TErrorMessageHolder {
     TString Message;
 };
 
+struct TQuantizedFeaturesHolder {
+    TFullModel SourceModel; // shares model data, used to check quantization compatibility
+    TIntrusivePtr<NCB::NModelEvaluation::IQuantizedData> QuantizedFeatures;
+};
+
 extern "C" {
 CATBOOST_API ModelCalcerHandle* ModelCalcerCreate() {
     try {
@@ -177,10 +182,72 @@ CATBOOST_API bool CalcModelPredictionWithHashedCatFeatures(ModelCalcerHandle* mo
     return true;
 }
 
+CATBOOST_API QuantizedFeaturesHandle* QuantizeFeatures(
+        ModelCalcerHandle* modelHandle,
+        size_t docCount,
+        const float** floatFeatures, size_t floatFeaturesSize,
+        const char*** catFeatures, size_t catFeaturesSize) {
+    try {
+        TVector<TConstArrayRef<float>> floatFeaturesVec(docCount);
+        TVector<TVector<TStringBuf>> catFeaturesVec(docCount, TVector<TStringBuf>(catFeaturesSize));
+        TVector<TConstArrayRef<TStringBuf>> catFeaturesRefs(docCount);
+        for (size_t i = 0; i < docCount; ++i) {
+            floatFeaturesVec[i] = TConstArrayRef<float>(floatFeatures[i], floatFeaturesSize);
+            for (size_t catFeatureIdx = 0; catFeatureIdx < catFeaturesSize; ++catFeatureIdx) {
+                catFeaturesVec[i][catFeatureIdx] = catFeatures[i][catFeatureIdx];
+            }
+            catFeaturesRefs[i] = catFeaturesVec[i];
+        }
+        auto holder = MakeHolder<TQuantizedFeaturesHolder>();
+        holder->SourceModel = *FULL_MODEL_PTR(modelHandle);
+        holder->QuantizedFeatures = holder->SourceModel.QuantizeFeatures(floatFeaturesVec, catFeaturesRefs);
+        return holder.Release();
+    } catch (...) {
+        Singleton<TErrorMessageHolder>()->Message = CurrentExceptionMessage();
+    }
+
+    return nullptr;
+}
+
+CATBOOST_API void QuantizedFeaturesDelete(QuantizedFeaturesHandle* quantizedFeaturesHandle) {
+    if (quantizedFeaturesHandle != nullptr) {
+        delete (TQuantizedFeaturesHolder*)quantizedFeaturesHandle;
+    }
+}
+
+CATBOOST_API bool CalcModelPredictionOnQuantizedFeatures(
+        ModelCalcerHandle* modelHandle,
+        QuantizedFeaturesHandle* quantizedFeaturesHandle,
+        size_t treeStart, size_t treeEnd,
+        double* result, size_t resultSize) {
+    try {
+        CB_ENSURE(quantizedFeaturesHandle != nullptr, "Got null quantized features handle");
+        const auto* holder = (const TQuantizedFeaturesHolder*)quantizedFeaturesHandle;
+        const auto& model = *FULL_MODEL_PTR(modelHandle);
+        CB_ENSURE(
+            model.HasSameFeaturesQuantization(holder->SourceModel),
+            "Features were quantized by a model with different features quantization"
+        );
+        CB_ENSURE(treeStart <= treeEnd && treeEnd <= model.GetTreeCount(), "Incorrect tree range");
+        model.Calc(holder->QuantizedFeatures.Get(), treeStart, treeEnd, TArrayRef<double>(result, resultSize));
+    } catch (...) {
+        Singleton<TErrorMessageHolder>()->Message = CurrentExceptionMessage();
+        return false;
+    }
+    return true;
+}
+
 CATBOOST_API int GetStringCatFeatureHash(const char* data, size_t size) {
     return CalcCatFeatureHash(TStringBuf(data, size));
 }
 
+CATBOOST_API void GetStringCatFeatureHashes(const char** data, const size_t* sizes, size_t count, int* hashes) {
+    TCatFeatureHashCache hashCache;
+    for (size_t i = 0; i < count; ++i) {
+        hashes[i] = hashCache(TStringBuf(data[i], sizes[i]));
+    }
+}
+
 CATBOOST_API int GetIntegerCatFeatureHash(long long val) {
     TStringBuilder valStr;
     valStr << val;
@@ -19,6 +19,7 @@ extern "C" {
 #endif
 
 typedef void ModelCalcerHandle;
+typedef void QuantizedFeaturesHandle;
 
 /**
  * Create empty model handle
@@ -171,6 +172,49 @@ CATBOOST_API bool CalcModelPredictionWithHashedCatFeatures(
     const int** catFeatures, size_t catFeaturesSize,
     double* result, size_t resultSize);
 
+/**
+ * Binarize float features and string categorical feature values with model borders.
+ * Returned handle can be evaluated with CalcModelPredictionOnQuantizedFeatures on any tree range
+ * of this model or of any other model with the same features quantization
+ * (e.g. model variants trained with the same borders), so binarization cost is paid once per object.
+ * @param calcer model handle
+ * @param docCount object count
+ * @param floatFeatures array of array of float (first dimension is object index, second if feature index)
+ * @param floatFeaturesSize float feature count
+ * @param catFeatures array of array of char* categorical value pointers.
+ * String pointer should point to zero terminated string.
+ * @param catFeaturesSize categorical feature count
+ * @return quantized features handle (should be deleted with QuantizedFeaturesDelete), nullptr if error occured
+ */
+CATBOOST_API QuantizedFeaturesHandle* QuantizeFeatures(
+    ModelCalcerHandle* modelHandle,
+    size_t docCount,
+    const float** floatFeatures, size_t floatFeaturesSize,
+    const char*** catFeatures, size_t catFeaturesSize);
+
+/**
+ * Delete quantized features handle
+ * @param quantizedFeaturesHandle
+ */
+CATBOOST_API void QuantizedFeaturesDelete(QuantizedFeaturesHandle* quantizedFeaturesHandle);
+
+/**
+ * Calculate raw model predictions of trees from [treeStart; treeEnd) interval on quantized features
+ * @param calcer model handle, should have the same features quantization as the model used in QuantizeFeatures
+ * @param quantizedFeaturesHandle quantized features handle created by QuantizeFeatures
+ * @param treeStart
+ * @param treeEnd
+ * @param result pointer to user allocated results vector
+ * @param resultSize result size should be equal to modelApproxDimension * docCount
+ * (e.g. for non multiclass models should be equal to docCount)
+ * @return false if error occured
+ */
+CATBOOST_API bool CalcModelPredictionOnQuantizedFeatures(
+    ModelCalcerHandle* modelHandle,
+    QuantizedFeaturesHandle* quantizedFeaturesHandle,
+    size_t treeStart, size_t treeEnd,
+    double* result, size_t resultSize);
+
 /**
  * Get hash for given string value
  * @param data we don't expect data to be zero terminated, so pass correct size
@@ -179,6 +223,17 @@ CATBOOST_API bool CalcModelPredictionWithHashedCatFeatures(
  */
 CATBOOST_API int GetStringCatFeatureHash(const char* data, size_t size);
 
+/**
+ * Get hashes for a batch of string values, e.g. all values of a categorical feature column.
+ * Repeated values are hashed once, so hashes can be passed to CalcModelPredictionWithHashedCatFeatures
+ * instead of hashing strings on every model evaluation.
+ * @param data array of string pointers, we don't expect strings to be zero terminated
+ * @param sizes array of string lengths
+ * @param count number of values
+ * @param hashes pointer to user allocated array of count hash values
+ */
+CATBOOST_API void GetStringCatFeatureHashes(const char** data, const size_t* sizes, size_t count, int* hashes);
+
 /**
  * Special case for hash calculation - integer hash.
  * Internally we cast value to string and then calulcate string hash function.
@@ -0,0 +1,71 @@
+#include <catboost/libs/model_interface/wrapped_calcer.h>
+
+#include <catboost/libs/model/model.h>
+#include <catboost/libs/model/ut/lib/model_test_helpers.h>
+
+#include <library/cpp/testing/unittest/registar.h>
+
+#include <util/generic/xrange.h>
+#include <util/random/fast.h>
+
+
+static ModelCalcerWrapper MakeCalcer(const TFullModel& model) {
+    const TString modelBuffer = SerializeModel(model);
+    return ModelCalcerWrapper(modelBuffer.data(), modelBuffer.size());
+}
+
+Y_UNIT_TEST_SUITE(TWrappedCalcerTest) {
+    Y_UNIT_TEST(TestCalcOnQuantizedFeatures) {
+        const auto model = TrainFloatCatboostModel();
+        const auto calcer = MakeCalcer(model);
+        const size_t treeCount = calcer.GetTreeCount();
+        const size_t middle = treeCount / 2;
+
+        TFastRng64 rng(0);
+        std::vector<std::vector<float>> floatFeatures(100, std::vector<float>(calcer.GetFloatFeaturesCount()));
+        for (auto& objectFeatures : floatFeatures) {
+            for (auto& value : objectFeatures) {
+                value = rng.GenRandReal1();
+            }
+        }
+
+        const auto quantizedFeatures = calcer.QuantizeFeatures(floatFeatures, {});
+        UNIT_ASSERT_VALUES_EQUAL(quantizedFeatures.GetDocCount(), floatFeatures.size());
+
+        const auto expected = calcer.CalcFlat(floatFeatures);
+        const auto results = calcer.CalcOnQuantizedFeatures(quantizedFeatures);
+        UNIT_ASSERT_VALUES_EQUAL(expected.size(), results.size());
+        for (auto i : xrange(expected.size())) {
+            UNIT_ASSERT_DOUBLES_EQUAL(expected[i], results[i], 1e-9);
+        }
+
+        const auto firstTreesResults = calcer.CalcOnQuantizedFeatures(quantizedFeatures, 0, middle);
+        const auto lastTreesResults = calcer.CalcOnQuantizedFeatures(quantizedFeatures, middle, treeCount);
+        for (auto i : xrange(expected.size())) {
+            UNIT_ASSERT_DOUBLES_EQUAL(expected[i], firstTreesResults[i] + lastTreesResults[i], 1e-9);
+        }
+
+        UNIT_ASSERT_EXCEPTION(calcer.CalcOnQuantizedFeatures(quantizedFeatures, 0, treeCount + 1), std::runtime_error);
+    }
+
+    Y_UNIT_TEST(TestCalcOnFeaturesQuantizedByOtherModel) {
+        const auto model = TrainFloatCatboostModel();
+        const auto calcer = MakeCalcer(model);
+        const std::vector<std::vector<float>> floatFeatures = {{0.1f, 0.5f, 0.9f}, {0.7f, 0.2f, 0.4f}};
+        const auto quantizedFeatures = calcer.QuantizeFeatures(floatFeatures, {});
+
+        // same borders, so quantized features are accepted
+        TFullModel scaledModel = model;
+        scaledModel.SetScaleAndBias({2.0, {0.5}});
+        const auto scaledCalcer = MakeCalcer(scaledModel);
+        const auto expected = scaledCalcer.CalcFlat(floatFeatures);
+        const auto results = scaledCalcer.CalcOnQuantizedFeatures(quantizedFeatures);
+        for (auto i : xrange(expected.size())) {
+            UNIT_ASSERT_DOUBLES_EQUAL(expected[i], results[i], 1e-9);
+        }
+
+        // model with other borders rejects them
+        const auto otherCalcer = MakeCalcer(TrainFloatCatboostModel(/*iterations*/ 5, /*seed*/ 42));
+        UNIT_ASSERT_EXCEPTION(otherCalcer.CalcOnQuantizedFeatures(quantizedFeatures), std::runtime_error);
+    }
+}
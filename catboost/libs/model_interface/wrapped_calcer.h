@@ -8,6 +8,28 @@
 #include <functional>
 #include <memory>
 
+/**
+ * Features of a batch of objects binarized with model borders, see ModelCalcerWrapper::QuantizeFeatures
+ */
+class ModelQuantizedFeatures {
+public:
+    size_t GetDocCount() const {
+        return DocCount;
+    }
+
+private:
+    friend class ModelCalcerWrapper;
+
+    ModelQuantizedFeatures(QuantizedFeaturesHandle* handle, size_t docCount)
+        : QuantizedFeaturesHolder(QuantizedFeaturesHolderType(handle, QuantizedFeaturesDelete))
+        , DocCount(docCount)
+    {}
+
+    using QuantizedFeaturesHolderType = std::unique_ptr<QuantizedFeaturesHandle, std::function<void(QuantizedFeaturesHandle*)>>;
+    QuantizedFeaturesHolderType QuantizedFeaturesHolder;
+    size_t DocCount = 0;
+};
+
 /**
  * Model C API header-only wrapper class
  * Currently supports only raw-value predictions
@@ -271,6 +293,74 @@ public:
         return result;
     }
 
+    /**
+     * Binarize float features and categorical feature values with model borders.
+     * Result can be evaluated with CalcOnQuantizedFeatures on any tree range of this model
+     * or of any other model with the same features quantization.
+     * floatFeatures should contain a (possibly empty) vector for each object.
+     * **WARNING** categorical features string values should not contain zero bytes in the middle of the string.
+     * @param floatFeatures
+     * @param catFeatures
+     * @return quantized features
+     */
+    ModelQuantizedFeatures QuantizeFeatures(
+        const std::vector<std::vector<float>>& floatFeatures,
+        const std::vector<std::vector<std::string>>& catFeatures
+    ) const {
+        std::vector<const float*> floatPtrsVector;
+        size_t floatFeatureCount = 0;
+
+        for (const auto& floatFeatureVec : floatFeatures) {
+            if (floatFeatureCount == 0) {
+                floatFeatureCount = floatFeatureVec.size();
+            }
+            floatPtrsVector.push_back(floatFeatureVec.data());
+        }
+
+        size_t catFeatureCount = 0;
+        std::vector<const char*> catFeaturesPtrsVector;
+        std::vector<const char**> charPtrPtrsVector;
+        FromStringToCharVectors(catFeatures, &catFeatureCount, &catFeaturesPtrsVector, &charPtrPtrsVector);
+
+        QuantizedFeaturesHandle* quantizedFeaturesHandle = ::QuantizeFeatures(
+            CalcerHolder.get(),
+            floatFeatures.size(),
+            floatPtrsVector.data(), floatFeatureCount,
+            charPtrPtrsVector.data(), catFeatureCount);
+        if (quantizedFeaturesHandle == nullptr) {
+            throw std::runtime_error(GetErrorString());
+        }
+        return ModelQuantizedFeatures(quantizedFeaturesHandle, floatFeatures.size());
+    }
+
+    /**
+     * Evaluate trees from [treeStart; treeEnd) interval on features quantized by QuantizeFeatures
+     * @param quantizedFeatures
+     * @param treeStart
+     * @param treeEnd
+     * @return vector of raw prediction values, approx dimension values for each object
+     */
+    std::vector<double> CalcOnQuantizedFeatures(
+        const ModelQuantizedFeatures& quantizedFeatures,
+        size_t treeStart,
+        size_t treeEnd
+    ) const {
+        std::vector<double> result(quantizedFeatures.GetDocCount() * GetDimensionsCount());
+        if (!CalcModelPredictionOnQuantizedFeatures(
+            CalcerHolder.get(),
+            quantizedFeatures.QuantizedFeaturesHolder.get(),
+            treeStart, treeEnd,
+            result.data(), result.size())
+        ) {
+            throw std::runtime_error(GetErrorString());
+        }
+        return result;
+    }
+
+    std::vector<double> CalcOnQuantizedFeatures(const ModelQuantizedFeatures& quantizedFeatures) const {
+        return CalcOnQuantizedFeatures(quantizedFeatures, 0, GetTreeCount());
+    }
+
 
     bool InitFromFile(const std::string& filename) {
         return LoadFullModelFromFile(CalcerHolder.get(), filename.c_str());
@@ -296,6 +386,10 @@ public:
         return ::GetCatFeaturesCount(CalcerHolder.get());
     }
 
+    size_t GetDimensionsCount() const {
+        return ::GetDimensionsCount(CalcerHolder.get());
+    }
+
     bool CheckMetadataHasKey(const std::string& key) const {
         return ::CheckModelMetadataHasKey(CalcerHolder.get(), key.c_str(), key.size());
     }
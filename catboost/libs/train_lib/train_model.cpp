@@ -23,6 +23,7 @@
 #include <catboost/libs/helpers/mem_usage.h>
 #include <catboost/libs/helpers/permutation.h>
 #include <catboost/libs/helpers/query_info_helper.h>
+#include <catboost/libs/helpers/thread_affinity.h>
 #include <catboost/libs/helpers/vector_helpers.h>
 #include <catboost/private/libs/labels/external_label_helper.h>
 #include <catboost/libs/loggers/catboost_logger_helpers.h>
@@ -321,6 +322,15 @@ static void InitializeSamplingStructures(
         defaultCalcStatsObjBlockSize,
         GetBernoulliSampleRate(ctx->Params.ObliviousTreeOptions->BootstrapConfig)
     ); // TODO(espetrov): create only if sample rate < 1
+    if (ctx->Params.ObliviousTreeOptions->FeaturePreselectionCount.Get() > 0) {
+        ctx->PreselectionDocs.Create(
+            ctx->LearnProgress->Folds,
+            isPairwiseScoring,
+            data.EstimatedObjectsData.GetFeatureCount() != 0,
+            defaultCalcStatsObjBlockSize,
+            ctx->Params.ObliviousTreeOptions->FeaturePreselectionSampleRate.Get()
+        );
+    }
 }
 
 static void LogThatStoppingOccured(const TErrorTracker& errorTracker) {
@@ -389,7 +399,7 @@ static void Train(
 
         if (timer.Passed() > ctx->OutputOptions.GetSnapshotSaveInterval()) {
             profile.AddOperation("Save snapshot");
-            ctx->SaveProgress(onSaveSnapshotCallback);
+            ctx->SaveProgress(onSaveSnapshotCallback, /*saveInBackground*/ true);
             timer.Reset();
         }
 
@@ -791,6 +801,12 @@ namespace {
                     );
                 }
             }
+            if (catboostOptions.SystemOptions->PinThreads.Get()) {
+                // do it before any training data structures are allocated so that buffers first touched
+                // by worker threads are not all placed on the node of the main thread
+                PinLocalExecutorThreadsToCpus(localExecutor);
+            }
+
             TLearnContext ctx(
                 catboostOptions,
                 objectiveDescriptor,
@@ -12,6 +12,7 @@
 #include "yetirank_helpers.h"
 
 #include <catboost/libs/data/data_provider.h>
+#include <catboost/libs/helpers/dispatch_generic_lambda.h>
 #include <catboost/libs/helpers/vector_helpers.h>
 #include <catboost/libs/helpers/parallel_tasks.h>
 #include <catboost/libs/helpers/quantile.h>
@@ -158,7 +159,74 @@ static void CalcLeafDersImpl(
     }
 }
 
-static void CalcLeafDers(
+// CalcDersRange and CalcLeafDersImpl fused for RMSE: derivatives are summed into leaves right away
+// without going through the scratch buffer. Each row does the same arithmetic as the unfused path,
+// kept in separate statements so that it cannot be contracted into FMA, hence sums are bit-identical
+template <bool UseWeights, bool HasDelta>
+static void CalcRMSELeafDersImpl(
+    int rowStart,
+    int rowCount,
+    TConstArrayRef<TIndexType> leafIndices,
+    TConstArrayRef<float> targets,
+    TConstArrayRef<float> weights,
+    TConstArrayRef<double> approxes,
+    TConstArrayRef<double> approxesDelta,
+    TArrayRef<TDers> leafDers,
+    TArrayRef<double> leafWeights) {
+    for (auto rowIdx : xrange(rowStart, rowStart + rowCount)) {
+        const double approx = HasDelta ? approxes[rowIdx] + approxesDelta[rowIdx] : approxes[rowIdx];
+        const double rowWeight = UseWeights ? weights[rowIdx] : 1;
+        const double der1 = (targets[rowIdx] - approx) * rowWeight;
+        const double der2 = TRMSEError::RMSE_DER2 * rowWeight;
+        TDers& ders = leafDers[leafIndices[rowIdx]];
+        ders.Der1 += der1;
+        ders.Der2 += der2;
+        leafWeights[leafIndices[rowIdx]] += rowWeight;
+    }
+}
+
+// Same for Logloss and CrossEntropy with exponentiated approxes, where TCrossEntropyError needs no exp
+template <bool UseWeights, bool HasDelta>
+static void CalcExpApproxCrossEntropyLeafDersImpl(
+    int rowStart,
+    int rowCount,
+    TConstArrayRef<TIndexType> leafIndices,
+    TConstArrayRef<float> targets,
+    TConstArrayRef<float> weights,
+    TConstArrayRef<double> expApproxes,
+    TConstArrayRef<double> expApproxesDelta,
+    TArrayRef<TDers> leafDers,
+    TArrayRef<double> leafWeights) {
+    for (auto rowIdx : xrange(rowStart, rowStart + rowCount)) {
+        const double e = HasDelta ? expApproxes[rowIdx] * expApproxesDelta[rowIdx] : expApproxes[rowIdx];
+        const double p = 1 - 1 / (1 + e);
+        const double rowWeight = UseWeights ? weights[rowIdx] : 1;
+        const double der1 = (targets[rowIdx] - p) * rowWeight;
+        const double der2 = -p * (1 - p) * rowWeight;
+        TDers& ders = leafDers[leafIndices[rowIdx]];
+        ders.Der1 += der1;
+        ders.Der2 += der2;
+        leafWeights[leafIndices[rowIdx]] += rowWeight;
+    }
+}
+
+enum class ELeafDersKernel {
+    Generic,
+    RMSE,
+    ExpApproxCrossEntropy
+};
+
+static ELeafDersKernel GetLeafDersKernel(const IDerCalcer& error) {
+    if (dynamic_cast<const TRMSEError*>(&error) != nullptr) {
+        return ELeafDersKernel::RMSE;
+    }
+    if (dynamic_cast<const TCrossEntropyError*>(&error) != nullptr && error.GetIsExpApprox()) {
+        return ELeafDersKernel::ExpApproxCrossEntropy;
+    }
+    return ELeafDersKernel::Generic;
+}
+
+void CalcLeafDers(
     TConstArrayRef<TIndexType> indices,
     TConstArrayRef<float> targets,
     TConstArrayRef<float> weights,
@@ -185,6 +253,7 @@ static void CalcLeafDers(
     // Check speedup on flights dataset.
     TVector<TVector<double>> blockBucketSumWeights(blockParams.GetBlockCount(), TVector<double>(leafCount, 0));
     TVector<double>* blockBucketSumWeightsData = blockBucketSumWeights.data();
+    const ELeafDersKernel kernel = GetLeafDersKernel(error);
     localExecutor->ExecRangeWithThrow(
         [=, &error](int blockId) {
             constexpr int innerBlockSize = APPROX_BLOCK_SIZE;
@@ -198,6 +267,43 @@ static void CalcLeafDers(
             const auto bucketDers = MakeArrayRef(blockBucketDersData[blockId].data(), leafCount);
             const auto bucketSumWeights = MakeArrayRef(blockBucketSumWeightsData[blockId].data(), leafCount);
 
+            if (kernel == ELeafDersKernel::RMSE) {
+                DispatchGenericLambda(
+                    [&] (auto useWeights, auto hasDelta) {
+                        CalcRMSELeafDersImpl<useWeights, hasDelta>(
+                            blockStart,
+                            nextBlockStart - blockStart,
+                            indices,
+                            targets,
+                            weights,
+                            approxes,
+                            approxesDelta,
+                            bucketDers,
+                            bucketSumWeights);
+                    },
+                    !weights.empty(),
+                    !approxesDelta.empty());
+                return;
+            }
+            if (kernel == ELeafDersKernel::ExpApproxCrossEntropy) {
+                DispatchGenericLambda(
+                    [&] (auto useWeights, auto hasDelta) {
+                        CalcExpApproxCrossEntropyLeafDersImpl<useWeights, hasDelta>(
+                            blockStart,
+                            nextBlockStart - blockStart,
+                            indices,
+                            targets,
+                            weights,
+                            approxes,
+                            approxesDelta,
+                            bucketDers,
+                            bucketSumWeights);
+                    },
+                    !weights.empty(),
+                    !approxesDelta.empty());
+                return;
+            }
+
             for (int innerBlockStart = blockStart;
                  innerBlockStart < nextBlockStart;
                  innerBlockStart += innerBlockSize) {
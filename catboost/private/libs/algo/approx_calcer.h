@@ -2,10 +2,13 @@
 
 #include "fold.h"
 
+#include <catboost/private/libs/algo_helpers/ders_holder.h>
 #include <catboost/private/libs/algo_helpers/online_predictor.h>
 #include <catboost/private/libs/options/enum_helpers.h>
 #include <catboost/private/libs/options/restrictions.h>
 
+#include <util/generic/array_ref.h>
+
 
 class IDerCalcer;
 class TLearnContext;
@@ -30,6 +33,22 @@ void UpdateApproxDeltas(
     TVector<double>* deltasDimension
 );
 
+// Sums per object derivatives and weights over leaves, RMSE and Logloss use fused kernels
+void CalcLeafDers(
+    TConstArrayRef<TIndexType> indices,
+    TConstArrayRef<float> targets,
+    TConstArrayRef<float> weights,
+    TConstArrayRef<double> approxes,
+    TConstArrayRef<double> approxesDelta,
+    const IDerCalcer& error,
+    int sampleCount,
+    bool recalcLeafWeights,
+    ELeavesEstimation estimationMethod,
+    NPar::TLocalExecutor* localExecutor,
+    TArrayRef<TSum> leafDers,
+    TArrayRef<TDers> weightedDers // scratch of APPROX_BLOCK_SIZE * CB_THREAD_LIMIT size
+);
+
 void CalcLeafDersSimple(
     const TVector<TIndexType>& indices,
     const TFold& fold,
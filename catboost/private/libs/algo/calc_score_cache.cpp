@@ -565,6 +565,66 @@ void TCalcScoreFold::SelectSmallestSplitSide(
     SetPermutationBlockSizeAndCalcStatsRanges(FoldPermutationBlockSizeNotSet, FoldPermutationBlockSizeNotSet);
 }
 
+void TCalcScoreFold::SelectSubsample(
+    const TCalcScoreFold& fold,
+    ESamplingUnit samplingUnit,
+    TRestorableFastRng64* rand,
+    NPar::TLocalExecutor* localExecutor
+) {
+    SetSampledControl(fold.DocCount, samplingUnit, fold.LearnQueriesInfo, rand);
+
+    TVectorSlicing srcBlocks;
+    TVectorSlicing dstBlocks;
+    int blockCount = 0;
+
+    CreateBlocksAndUpdateQueriesInfoByControl(
+        localExecutor,
+        fold.DocCount,
+        fold.LearnQueriesInfo,
+        &blockCount,
+        &srcBlocks,
+        &dstBlocks,
+        &LearnQueriesInfo
+    );
+
+    DocCount = dstBlocks.Total;
+    HasOfflineEstimatedFeatures = fold.HasOfflineEstimatedFeatures;
+    LearnPermutationFeaturesSubset.Get<TIndexedSubset<ui32>>().yresize(DocCount);
+    if (HasOfflineEstimatedFeatures) {
+        LearnPermutationOfflineEstimatedFeaturesSubset.Get<TIndexedSubset<ui32>>().yresize(DocCount);
+    }
+
+    ClearBodyTail();
+    BodyTailCount = fold.GetBodyTailCount();
+    localExecutor->ExecRange(
+        [&](int blockIdx) {
+            int ignored;
+            const auto srcBlock = srcBlocks.Slices[blockIdx];
+            const auto srcControlRef = srcBlock.GetConstRef(Control);
+            const auto dstBlock = dstBlocks.Slices[blockIdx];
+            SetElements(
+                srcControlRef,
+                srcBlock.GetConstRef(fold.Indices),
+                GetElement<TIndexType>,
+                dstBlock.GetRef(Indices),
+                &ignored
+            );
+            SetElements(
+                srcControlRef,
+                srcBlock.GetConstRef(fold.IndexInFold),
+                GetElement<ui32>,
+                dstBlock.GetRef(IndexInFold),
+                &ignored
+            );
+            SelectBlockFromFold(fold, srcBlock, dstBlock);
+        },
+        0,
+        blockCount,
+        NPar::TLocalExecutor::WAIT_COMPLETE
+    );
+    SetPermutationBlockSizeAndCalcStatsRanges(FoldPermutationBlockSizeNotSet, FoldPermutationBlockSizeNotSet);
+}
+
 static void CalcCumulativeOffsets(const TVector<ui32>& counts, TVector<ui32>* offsets, ui32 startOffset = 0) {
     offsets->yresize(counts.size());
     TArrayRef<ui32> offsetsRef(*offsets);
@@ -241,6 +241,13 @@ public:
         const TCalcScoreFold& fold,
         NPar::TLocalExecutor* localExecutor
     );
+    // Bernoulli subsample of fold with sampleRate passed to Create
+    void SelectSubsample(
+        const TCalcScoreFold& fold,
+        ESamplingUnit samplingUnit,
+        TRestorableFastRng64* rand,
+        NPar::TLocalExecutor* localExecutor
+    );
     void Sample(
         const TFold& fold,
         ESamplingUnit samplingUnit,
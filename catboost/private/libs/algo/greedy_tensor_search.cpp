@@ -612,6 +612,85 @@ static void SelectCtrsToDropAfterCalc(
 }
 
 
+// Scores all non-ctr candidates on a subsample of sampled documents and leaves in tasks only the best
+// featurePreselectionCount of them, ctr candidates are always kept because computing them is the expensive part
+static void PreselectScoringTasks(
+    ui32 featurePreselectionCount,
+    ui64 randSeed,
+    const TVector<TCandidatesContext>& candidatesContexts,
+    const std::function<TVector<TVector<double>>(
+        const TCandidatesContext&,
+        const TCandidatesInfoList&,
+        const TCalcScoreFold&)>& calcCandidateScores,
+    TLearnContext* ctx,
+    TVector<std::pair<size_t, size_t>>* tasks) { // vector of (contextIdx, candId)
+
+    const auto getCandidate = [&] (const std::pair<size_t, size_t>& task) -> const TCandidatesInfoList& {
+        return candidatesContexts[task.first].CandidateList[task.second];
+    };
+
+    TVector<size_t> preselectionTasks;
+    for (auto taskIdx : xrange(tasks->size())) {
+        if (!getCandidate((*tasks)[taskIdx]).Candidates[0].SplitEnsemble.IsSplitOfType(ESplitType::OnlineCtr)) {
+            preselectionTasks.push_back(taskIdx);
+        }
+    }
+    if (preselectionTasks.size() <= featurePreselectionCount) {
+        return;
+    }
+
+    TRestorableFastRng64 rand(randSeed);
+    ctx->PreselectionDocs.SelectSubsample(
+        ctx->SampledDocs,
+        ctx->SampledDocs.HasQueryInfo() ? ESamplingUnit::Group : ESamplingUnit::Object,
+        &rand,
+        ctx->LocalExecutor);
+
+    TVector<double> preselectionScores(preselectionTasks.size(), MINIMAL_SCORE);
+    ctx->LocalExecutor->ExecRange(
+        [&] (int idx) {
+            const auto& task = (*tasks)[preselectionTasks[idx]];
+            const auto allScores = calcCandidateScores(
+                candidatesContexts[task.first],
+                getCandidate(task),
+                ctx->PreselectionDocs);
+            for (const auto& scores : allScores) {
+                for (double score : scores) {
+                    preselectionScores[idx] = Max(preselectionScores[idx], score);
+                }
+            }
+        },
+        0,
+        SafeIntegerCast<int>(preselectionTasks.size()),
+        NPar::TLocalExecutor::WAIT_COMPLETE);
+
+    TVector<size_t> order(preselectionTasks.size());
+    Iota(order.begin(), order.end(), 0);
+    StableSort(
+        order.begin(),
+        order.end(),
+        [&] (size_t lhs, size_t rhs) { return preselectionScores[lhs] > preselectionScores[rhs]; }
+    );
+    TVector<bool> isDropped(tasks->size(), false);
+    for (auto idx : xrange(static_cast<size_t>(featurePreselectionCount), order.size())) {
+        isDropped[preselectionTasks[order[idx]]] = true;
+    }
+
+    TVector<std::pair<size_t, size_t>> selectedTasks;
+    selectedTasks.reserve(tasks->size() - (preselectionTasks.size() - featurePreselectionCount));
+    for (auto taskIdx : xrange(tasks->size())) {
+        if (!isDropped[taskIdx]) {
+            selectedTasks.push_back((*tasks)[taskIdx]);
+        } else if (ctx->UseTreeLevelCaching()) {
+            // stats of dropped candidates are not updated at this depth
+            for (const auto& candidate : getCandidate((*tasks)[taskIdx]).Candidates) {
+                ctx->PrevTreeLevelStats.Stats.erase(candidate.SplitEnsemble);
+            }
+        }
+    }
+    *tasks = std::move(selectedTasks);
+}
+
 static void CalcBestScore(
     const TTrainingDataProviders& data,
     const TSplitTree& currentTree,
@@ -628,6 +707,51 @@ static void CalcBestScore(
         ? TVector<int>()
         : GetTreeMonotoneConstraints(currentTree, monotonicConstraints)
     );
+    const bool isPairwiseScoring = IsPairwiseScoring(ctx->Params.LossFunctionDescription->GetLossFunction());
+
+    const auto calcCandidateScores = [&] (
+        const TCandidatesContext& candidatesContext,
+        const TCandidatesInfoList& candidate,
+        const TCalcScoreFold& sampledDocs,
+        bool useTreeLevelCaching
+    ) {
+        TVector<TVector<double>> allScores(candidate.Candidates.size());
+        ctx->LocalExecutor->ExecRange(
+            [&](int oneCandidate) {
+                THolder<IScoreCalcer> scoreCalcer;
+                if (isPairwiseScoring) {
+                    scoreCalcer.Reset(new TPairwiseScoreCalcer);
+                } else {
+                    scoreCalcer = MakePointwiseScoreCalcer(
+                        ctx->Params.ObliviousTreeOptions->ScoreFunction
+                    );
+                }
+
+                CalcStatsAndScores(
+                    *candidatesContext.LearnData,
+                    fold->GetAllCtrs(),
+                    sampledDocs,
+                    ctx->SmallestSplitSideDocs,
+                    fold,
+                    pairs,
+                    ctx->Params,
+                    candidate.Candidates[oneCandidate],
+                    currentTree.GetDepth(),
+                    useTreeLevelCaching,
+                    currTreeMonotonicConstraints,
+                    monotonicConstraints,
+                    ctx->LocalExecutor,
+                    &ctx->PrevTreeLevelStats,
+                    /*stats3d*/nullptr,
+                    /*pairwiseStats*/nullptr,
+                    scoreCalcer.Get());
+                scoreCalcer->GetScores().swap(allScores[oneCandidate]);
+            },
+            0,
+            candidate.Candidates.ysize(),
+            NPar::TLocalExecutor::WAIT_COMPLETE);
+        return allScores;
+    };
 
     TVector<std::pair<size_t, size_t>> tasks; // vector of (contextIdx, candId)
 
@@ -638,6 +762,23 @@ static void CalcBestScore(
         }
     }
 
+    const ui32 featurePreselectionCount = ctx->Params.ObliviousTreeOptions->FeaturePreselectionCount;
+    if (featurePreselectionCount > 0 && !isPairwiseScoring) {
+        PreselectScoringTasks(
+            featurePreselectionCount,
+            randSeed,
+            *candidatesContexts,
+            [&] (
+                const TCandidatesContext& candidatesContext,
+                const TCandidatesInfoList& candidate,
+                const TCalcScoreFold& sampledDocs
+            ) {
+                return calcCandidateScores(candidatesContext, candidate, sampledDocs, /*useTreeLevelCaching*/ false);
+            },
+            ctx,
+            &tasks);
+    }
+
     ctx->LocalExecutor->ExecRange(
         [&] (int taskIdx) {
             TCandidatesContext& candidatesContext = (*candidatesContexts)[tasks[taskIdx].first];
@@ -658,41 +799,11 @@ static void CalcBestScore(
                         &fold->GetCtrRef(proj));
                 }
             }
-            TVector<TVector<double>> allScores(candidate.Candidates.size());
-            ctx->LocalExecutor->ExecRange(
-                [&](int oneCandidate) {
-                    THolder<IScoreCalcer> scoreCalcer;
-                    if (IsPairwiseScoring(ctx->Params.LossFunctionDescription->GetLossFunction())) {
-                        scoreCalcer.Reset(new TPairwiseScoreCalcer);
-                    } else {
-                        scoreCalcer = MakePointwiseScoreCalcer(
-                            ctx->Params.ObliviousTreeOptions->ScoreFunction
-                        );
-                    }
-
-                    CalcStatsAndScores(
-                        *candidatesContext.LearnData,
-                        fold->GetAllCtrs(),
-                        ctx->SampledDocs,
-                        ctx->SmallestSplitSideDocs,
-                        fold,
-                        pairs,
-                        ctx->Params,
-                        candidate.Candidates[oneCandidate],
-                        currentTree.GetDepth(),
-                        ctx->UseTreeLevelCaching(),
-                        currTreeMonotonicConstraints,
-                        monotonicConstraints,
-                        ctx->LocalExecutor,
-                        &ctx->PrevTreeLevelStats,
-                        /*stats3d*/nullptr,
-                        /*pairwiseStats*/nullptr,
-                        scoreCalcer.Get());
-                    scoreCalcer->GetScores().swap(allScores[oneCandidate]);
-                },
-                0,
-                candidate.Candidates.ysize(),
-                NPar::TLocalExecutor::WAIT_COMPLETE);
+            const TVector<TVector<double>> allScores = calcCandidateScores(
+                candidatesContext,
+                candidate,
+                ctx->SampledDocs,
+                ctx->UseTreeLevelCaching());
 
             if (splitEnsemble.IsSplitOfType(ESplitType::OnlineCtr) && candidate.ShouldDropCtrAfterCalc) {
                 fold->GetCtrRef(splitEnsemble.SplitCandidate.Ctr.Projection).Feature.clear();
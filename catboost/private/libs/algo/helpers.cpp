@@ -7,6 +7,9 @@
 #include <catboost/libs/logging/logging.h>
 
 #include <library/cpp/malloc/api/malloc.h>
+#include <library/cpp/threading/future/future.h>
+
+#include <util/generic/scope.h>
 
 #include <functional>
 
@@ -164,6 +167,78 @@ static TVector<int> FilterTestPools(const TTrainingDataProviders& trainingDataPr
     return filtered;
 }
 
+namespace {
+    struct TTestErrorsCalcer {
+        int TestIdx = 0;
+        TVector<const IMetric*> Metrics;
+        TMaybe<int> FilteredTrackerIdx;
+        TVector<TMetricHolder> Errors; // [metricIdx]
+    };
+}
+
+static TVector<TTestErrorsCalcer> CreateTestErrorsCalcers(
+    const TTrainingDataProviders& trainingDataProviders,
+    const TVector<THolder<IMetric>>& errors,
+    bool calcAllMetrics,
+    bool calcErrorTrackerMetric
+) {
+    TVector<TTestErrorsCalcer> calcers;
+    for (auto testIdx : FilterTestPools(trainingDataProviders, calcAllMetrics)) {
+        const auto& targetData = trainingDataProviders.Test[testIdx]->TargetData;
+
+        TTestErrorsCalcer calcer;
+        calcer.TestIdx = testIdx;
+        TMaybe<int> trackerIdx = calcErrorTrackerMetric ? TMaybe<int>(0) : Nothing();
+        calcer.Metrics = FilterTestMetrics(
+            errors,
+            calcAllMetrics,
+            targetData->GetTarget().Defined(),
+            trackerIdx,
+            &calcer.FilteredTrackerIdx
+        );
+        calcer.Errors.resize(calcer.Metrics.size());
+        calcers.push_back(std::move(calcer));
+    }
+    return calcers;
+}
+
+static void CalcTestErrors(
+    const TTrainingDataProviders& trainingDataProviders,
+    bool isAdditive,
+    TLearnContext* ctx,
+    TTestErrorsCalcer* calcer
+) {
+    TVector<const IMetric*> metrics;
+    TVector<int> metricIndices;
+    for (int i : xrange(calcer->Metrics.size())) {
+        if (calcer->Metrics[i]->IsAdditiveMetric() == isAdditive) {
+            metrics.push_back(calcer->Metrics[i]);
+            metricIndices.push_back(i);
+        }
+    }
+    if (metrics.empty()) {
+        return;
+    }
+
+    const auto& targetData = trainingDataProviders.Test[calcer->TestIdx]->TargetData;
+    auto weights = GetWeights(*targetData);
+    auto queryInfo = targetData->GetGroupInfo().GetOrElse(TConstArrayRef<TQueryInfo>());
+
+    auto errors = EvalErrorsWithCaching(
+        ctx->LearnProgress->TestApprox[calcer->TestIdx],
+        /*approxDelta*/{},
+        /*isExpApprox*/false,
+        targetData->GetTarget().GetOrElse(TConstArrayRef<TConstArrayRef<float>>()),
+        weights,
+        queryInfo,
+        metrics,
+        ctx->LocalExecutor
+    );
+    for (auto i : xrange(metrics.size())) {
+        calcer->Errors[metricIndices[i]] = std::move(errors[i]);
+    }
+}
+
 void CalcErrors(
     const TTrainingDataProviders& trainingDataProviders,
     const TVector<THolder<IMetric>>& errors,
@@ -171,6 +246,39 @@ void CalcErrors(
     bool calcErrorTrackerMetric,
     TLearnContext* ctx
 ) {
+    TVector<TTestErrorsCalcer> testErrorsCalcers;
+    NThreading::TFuture<void> nonAdditiveTestErrorsFuture;
+    if (trainingDataProviders.GetTestSampleCount() > 0) {
+        testErrorsCalcers = CreateTestErrorsCalcers(trainingDataProviders, errors, calcAllMetrics, calcErrorTrackerMetric);
+
+        // non-additive metrics (AUC, NDCG, PRAUC, ...) are mostly sequential, so evaluate them
+        // on a separate thread while learn and additive test metrics are being calculated
+        auto calcNonAdditiveTestErrors = [&] (int) {
+            for (auto& calcer : testErrorsCalcers) {
+                CalcTestErrors(trainingDataProviders, /*isAdditive*/ false, ctx, &calcer);
+            }
+        };
+        if (ctx->LocalExecutor->GetThreadCount() > 0) {
+            auto futures = ctx->LocalExecutor->ExecRangeWithFutures(
+                calcNonAdditiveTestErrors,
+                0,
+                1,
+                NPar::TLocalExecutor::HIGH_PRIORITY
+            );
+            Y_VERIFY(futures.size() == 1);
+            nonAdditiveTestErrorsFuture = std::move(futures[0]);
+        } else {
+            calcNonAdditiveTestErrors(0);
+        }
+    }
+    // only reached with a pending task if learn or additive metrics have thrown:
+    // the task references locals of this function, so it must finish before they are destroyed
+    Y_DEFER {
+        if (nonAdditiveTestErrorsFuture.Initialized()) {
+            nonAdditiveTestErrorsFuture.Wait();
+        }
+    };
+
     if (trainingDataProviders.Learn->GetObjectCount() > 0) {
         ctx->LearnProgress->MetricsAndTimeHistory.LearnMetricsHistory.emplace_back();
         if (calcAllMetrics) {
@@ -204,38 +312,24 @@ void CalcErrors(
     }
 
     if (trainingDataProviders.GetTestSampleCount() > 0) {
-        ctx->LearnProgress->MetricsAndTimeHistory.TestMetricsHistory.emplace_back();
-        for (auto testIdx : FilterTestPools(trainingDataProviders, calcAllMetrics)) {
-            const auto &targetData = trainingDataProviders.Test[testIdx]->TargetData;
-
-            auto maybeTarget = targetData->GetTarget();
-            auto weights = GetWeights(*targetData);
-            auto queryInfo = targetData->GetGroupInfo().GetOrElse(TConstArrayRef<TQueryInfo>());;
-
-            TMaybe<int> trackerIdx = calcErrorTrackerMetric ? TMaybe<int>(0) : Nothing();
-            TMaybe<int> filteredTrackerIdx;
-            auto testMetrics = FilterTestMetrics(errors, calcAllMetrics, maybeTarget.Defined(), trackerIdx, &filteredTrackerIdx);
-
-            auto errors = EvalErrorsWithCaching(
-                ctx->LearnProgress->TestApprox[testIdx],
-                /*approxDelta*/{},
-                /*isExpApprox*/false,
-                maybeTarget.GetOrElse(TConstArrayRef<TConstArrayRef<float>>()),
-                weights,
-                queryInfo,
-                testMetrics,
-                ctx->LocalExecutor
-            );
+        for (auto& calcer : testErrorsCalcers) {
+            CalcTestErrors(trainingDataProviders, /*isAdditive*/ true, ctx, &calcer);
+        }
+        if (nonAdditiveTestErrorsFuture.Initialized()) {
+            nonAdditiveTestErrorsFuture.GetValueSync(); // will rethrow if there was an exception
+        }
 
-            for (int i : xrange(testMetrics.size())) {
-                auto metric = testMetrics[i];
-                const bool updateBestIteration = filteredTrackerIdx && (i == *filteredTrackerIdx)
-                    && (testIdx == SafeIntegerCast<int>(trainingDataProviders.Test.size() - 1));
+        ctx->LearnProgress->MetricsAndTimeHistory.TestMetricsHistory.emplace_back();
+        for (const auto& calcer : testErrorsCalcers) {
+            for (int i : xrange(calcer.Metrics.size())) {
+                auto metric = calcer.Metrics[i];
+                const bool updateBestIteration = calcer.FilteredTrackerIdx && (i == *calcer.FilteredTrackerIdx)
+                    && (calcer.TestIdx == SafeIntegerCast<int>(trainingDataProviders.Test.size() - 1));
 
                 ctx->LearnProgress->MetricsAndTimeHistory.AddTestError(
-                    testIdx,
+                    calcer.TestIdx,
                     *metric,
-                    metric->GetFinalError(errors[i]),
+                    metric->GetFinalError(calcer.Errors[i]),
                     updateBestIteration
                 );
             }
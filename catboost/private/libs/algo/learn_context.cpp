@@ -29,6 +29,7 @@
 #include <util/generic/xrange.h>
 #include <util/folder/path.h>
 #include <util/stream/file.h>
+#include <util/stream/str.h>
 #include <util/system/fs.h>
 
 
@@ -360,24 +361,64 @@ TLearnContext::TLearnContext(
 
 
 TLearnContext::~TLearnContext() {
+    try {
+        WaitForSnapshotSaving();
+    } catch (...) {
+        CATBOOST_WARNING_LOG << "Can't save snapshot in background, got exception: " << CurrentExceptionMessage() << Endl;
+    }
     if (Params.SystemOptions->IsMaster()) {
         FinalizeMaster(this);
     }
 }
 
-void TLearnContext::SaveProgress(std::function<void(IOutputStream*)> onSaveSnapshot) {
+void TLearnContext::SaveProgress(std::function<void(IOutputStream*)> onSaveSnapshot, bool saveInBackground) {
     if (!OutputOptions.SaveSnapshot()) {
         return;
     }
+    WaitForSnapshotSaving();
+
     const auto snapshotBackup = Files.SnapshotFile + ".bak";
-    TProgressHelper(ToString(ETaskType::CPU)).Write(
-        snapshotBackup,
-        [&](IOutputStream* out) {
-            onSaveSnapshot(out);
-            ::SaveMany(out, *LearnProgress, Profile.DumpProfileInfo());
-        }
-    );
-    TFsPath(snapshotBackup).ForceRenameTo(Files.SnapshotFile);
+    const auto snapshotFile = Files.SnapshotFile;
+    if (!saveInBackground) {
+        TProgressHelper(ToString(ETaskType::CPU)).Write(
+            snapshotBackup,
+            [&](IOutputStream* out) {
+                onSaveSnapshot(out);
+                ::SaveMany(out, *LearnProgress, Profile.DumpProfileInfo());
+            }
+        );
+        TFsPath(snapshotBackup).ForceRenameTo(snapshotFile);
+        return;
+    }
+
+    // serialization to memory is much faster than writing to disk, so training is blocked only for the former
+    TStringStream snapshotData;
+    onSaveSnapshot(&snapshotData);
+    ::SaveMany(&snapshotData, *LearnProgress, Profile.DumpProfileInfo());
+    auto saveSnapshot = [snapshotBackup, snapshotFile, snapshotData = std::move(snapshotData.Str())] (int) {
+        TProgressHelper(ToString(ETaskType::CPU)).Write(
+            snapshotBackup,
+            [&](IOutputStream* out) {
+                out->Write(snapshotData.data(), snapshotData.size());
+            }
+        );
+        TFsPath(snapshotBackup).ForceRenameTo(snapshotFile);
+    };
+    if (!SnapshotExecutor) {
+        SnapshotExecutor = MakeHolder<NPar::TLocalExecutor>();
+        SnapshotExecutor->RunAdditionalThreads(1);
+    }
+    auto futures = SnapshotExecutor->ExecRangeWithFutures(saveSnapshot, 0, 1, NPar::TLocalExecutor::HIGH_PRIORITY);
+    Y_VERIFY(futures.size() == 1);
+    SnapshotSaved = std::move(futures[0]);
+}
+
+void TLearnContext::WaitForSnapshotSaving() {
+    if (SnapshotSaved.Initialized()) {
+        auto snapshotSaved = std::move(SnapshotSaved);
+        SnapshotSaved = NThreading::TFuture<void>();
+        snapshotSaved.GetValueSync(); // will rethrow if there was an exception during saving
+    }
 }
 
 bool TLearnContext::TryLoadProgress(std::function<bool(IInputStream*)> onLoadSnapshot) {
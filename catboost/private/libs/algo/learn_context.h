@@ -20,6 +20,7 @@
 #include <catboost/private/libs/options/catboost_options.h>
 
 #include <library/cpp/json/json_reader.h>
+#include <library/cpp/threading/future/future.h>
 
 #include <util/generic/noncopyable.h>
 #include <util/generic/hash_set.h>
@@ -205,7 +206,13 @@ public:
 
     ~TLearnContext();
 
-    void SaveProgress(std::function<void(IOutputStream*)> onSaveSnapshot = [] (IOutputStream* /*snapshot*/) {});
+    /* if saveInBackground is true progress is serialized to memory and written to the snapshot file
+     * by a separate thread, at most one snapshot is being saved at any moment
+     */
+    void SaveProgress(
+        std::function<void(IOutputStream*)> onSaveSnapshot = [] (IOutputStream* /*snapshot*/) {},
+        bool saveInBackground = false);
+    void WaitForSnapshotSaving(); // rethrows an exception of the background saving if there was one
     bool TryLoadProgress(std::function<bool(IInputStream*)> onLoadSnapshot = [] (IInputStream* /*snapshot*/) { return true; });
     bool UseTreeLevelCaching() const;
     bool GetHasWeights() const;
@@ -217,12 +224,16 @@ public:
 
     TCalcScoreFold SmallestSplitSideDocs;
     TCalcScoreFold SampledDocs;
+    TCalcScoreFold PreselectionDocs; // subsample of SampledDocs for feature preselection
     TBucketStatsCache PrevTreeLevelStats;
     TProfileInfo Profile;
 
 private:
     bool UseTreeLevelCachingFlag;
     bool HasWeights;
+
+    THolder<NPar::TLocalExecutor> SnapshotExecutor; // created on first background save
+    NThreading::TFuture<void> SnapshotSaved;
 };
 
 bool NeedToUseTreeLevelCaching(
@@ -64,6 +64,54 @@ static double CalculateMeanGradValue(const TVector<TConstArrayRef<double>>& deri
         return sumOfGradients / cnt;
 }
 
+static TVector<TConstArrayRef<double>> GetTailDerivatives(
+    EBoostingType boostingType,
+    ui32 sampleCount,
+    const TFold& fold,
+    NPar::TLocalExecutor* localExecutor,
+    TVector<TVector<double>>* tailDerivatives
+) {
+    const auto approxDimension = fold.GetApproxDimension();
+    TVector<TConstArrayRef<double>> derivatives(approxDimension);
+    for (auto dim : xrange(approxDimension)) {
+        derivatives[dim] = fold.BodyTailArr[0].WeightedDerivatives[dim];
+    }
+    if (boostingType == EBoostingType::Ordered) {
+        tailDerivatives->resize(approxDimension);
+        for (auto dim : xrange(approxDimension)) {
+            (*tailDerivatives)[dim].yresize(sampleCount);
+        }
+        localExecutor->ExecRange(
+            [&](ui32 bodyTailId) {
+                const TFold::TBodyTail& bt = fold.BodyTailArr[bodyTailId];
+                for (auto dim : xrange(approxDimension)) {
+                    TConstArrayRef<double> bodyTailDerivatives = bt.WeightedDerivatives[dim];
+                    if (bodyTailId == 0) {
+                        Copy(
+                            bodyTailDerivatives.begin(),
+                            bodyTailDerivatives.begin() + bt.TailFinish,
+                            (*tailDerivatives)[dim].begin()
+                        );
+                    } else {
+                        Copy(
+                            bodyTailDerivatives.begin() + bt.BodyFinish,
+                            bodyTailDerivatives.begin() + bt.TailFinish,
+                            (*tailDerivatives)[dim].begin() + bt.BodyFinish
+                        );
+                    }
+                }
+            },
+            0,
+            fold.BodyTailArr.size(),
+            NPar::TLocalExecutor::WAIT_COMPLETE
+        );
+        for (auto dim : xrange(approxDimension)) {
+            derivatives[dim] = (*tailDerivatives)[dim];
+        }
+    }
+    return derivatives;
+}
+
 double TMvsSampler::GetLambda(
     const TVector<TConstArrayRef<double>>& derivatives,
     const TVector<TVector<TVector<double>>>& leafValues,
@@ -129,43 +177,12 @@ void TMvsSampler::GenSampleWeights(
     } else {
         const auto approxDimension = fold->GetApproxDimension();
         TVector<TVector<double>> tailDerivatives;
-        TVector<TConstArrayRef<double>> derivatives(approxDimension);
-        for (auto dim : xrange(approxDimension)) {
-            derivatives[dim] = fold->BodyTailArr[0].WeightedDerivatives[dim];
-        }
-        if (boostingType == EBoostingType::Ordered) {
-            tailDerivatives.resize(approxDimension);
-            for (auto dim : xrange(approxDimension)) {
-                tailDerivatives[dim].yresize(SampleCount);
-            }
-            localExecutor->ExecRange(
-                [&](ui32 bodyTailId) {
-                    const TFold::TBodyTail& bt = fold->BodyTailArr[bodyTailId];
-                    for (auto dim : xrange(approxDimension)) {
-                        TConstArrayRef<double> bodyTailDerivatives = bt.WeightedDerivatives[dim];
-                        if (bodyTailId == 0) {
-                            Copy(
-                                bodyTailDerivatives.begin(),
-                                bodyTailDerivatives.begin() + bt.TailFinish,
-                                tailDerivatives[dim].begin()
-                            );
-                        } else {
-                            Copy(
-                                bodyTailDerivatives.begin() + bt.BodyFinish,
-                                bodyTailDerivatives.begin() + bt.TailFinish,
-                                tailDerivatives[dim].begin() + bt.BodyFinish
-                            );
-                        }
-                    }
-                },
-                0,
-                fold->BodyTailArr.size(),
-                NPar::TLocalExecutor::WAIT_COMPLETE
-            );
-            for (auto dim : xrange(approxDimension)) {
-                derivatives[dim] = tailDerivatives[dim];
-            }
-        }
+        const TVector<TConstArrayRef<double>> derivatives = GetTailDerivatives(
+            boostingType,
+            SampleCount,
+            *fold,
+            localExecutor,
+            &tailDerivatives);
 
         double lambda = GetLambda(derivatives, leafValues, localExecutor);
 
@@ -222,3 +239,80 @@ void TMvsSampler::GenSampleWeights(
         );
     }
 }
+
+void TGossSampler::GenSampleWeights(
+    EBoostingType boostingType,
+    TRestorableFastRng64* rand,
+    NPar::TLocalExecutor* localExecutor,
+    TFold* fold) const {
+
+    if (OtherRate == 1.0f) {
+        Fill(fold->SampleWeights.begin(), fold->SampleWeights.end(), 1.0f);
+        return;
+    }
+    const auto approxDimension = fold->GetApproxDimension();
+    TVector<TVector<double>> tailDerivatives;
+    const TVector<TConstArrayRef<double>> derivatives = GetTailDerivatives(
+        boostingType,
+        SampleCount,
+        *fold,
+        localExecutor,
+        &tailDerivatives);
+
+    NPar::TLocalExecutor::TExecRangeParams blockParams(0, SampleCount);
+    blockParams.SetBlockSize(BlockSize);
+
+    TVector<double> gradients;
+    gradients.yresize(SampleCount);
+    localExecutor->ExecRange(
+        [&](ui32 idx) {
+            double grad2 = 0;
+            for (auto dim : xrange(approxDimension)) {
+                const double der = derivatives[dim][idx];
+                grad2 += der * der;
+            }
+            gradients[idx] = grad2;
+        },
+        blockParams,
+        NPar::TLocalExecutor::WAIT_COMPLETE
+    );
+
+    // exactly topCount objects with the largest squared gradient norm are always taken, ties are broken
+    // by NthElement so that constant or discrete gradients do not leave the top part short
+    const ui32 topCount = Min(static_cast<ui32>(TopRate * SampleCount), SampleCount);
+    TVector<ui8> isTop(SampleCount, 0);
+    if (topCount > 0) {
+        TVector<ui32> indices;
+        indices.yresize(SampleCount);
+        Iota(indices.begin(), indices.end(), 0);
+        NthElement(
+            indices.begin(),
+            indices.begin() + topCount,
+            indices.end(),
+            [&gradients](ui32 lhs, ui32 rhs) { return gradients[lhs] > gradients[rhs]; });
+        for (auto idx : MakeArrayRef(indices.data(), topCount)) {
+            isTop[idx] = 1;
+        }
+    }
+
+    const double otherWeight = 1.0 / OtherRate;
+    const ui64 randSeed = rand->GenRand();
+    localExecutor->ExecRange(
+        [&](ui32 blockId) {
+            TRestorableFastRng64 prng(randSeed + blockId);
+            prng.Advance(10); // reduce correlation between RNGs in different threads
+            NPar::TLocalExecutor::BlockedLoopBody(
+                blockParams,
+                [&](ui32 i) {
+                    if (isTop[i]) {
+                        fold->SampleWeights[i] = 1.0f;
+                    } else {
+                        fold->SampleWeights[i] = (prng.GenRandReal1() < OtherRate) ? otherWeight : 0.0f;
+                    }
+                })(blockId);
+        },
+        0,
+        blockParams.GetBlockCount(),
+        NPar::TLocalExecutor::WAIT_COMPLETE
+    );
+}
@@ -48,3 +48,26 @@ private:
     const ui32 BlockSize = 8192;
     TMaybe<float> Lambda;
 };
+
+
+// Gradient-based One-Side Sampling: objects from the top TopRate fraction by gradient norm
+// are always taken, the rest are taken with probability OtherRate and upweighted by 1 / OtherRate
+class TGossSampler {
+public:
+    TGossSampler(ui32 sampleCount, float topRate, float otherRate)
+        : SampleCount(sampleCount)
+        , TopRate(topRate)
+        , OtherRate(otherRate)
+    {}
+    void GenSampleWeights(
+        EBoostingType boostingType,
+        TRestorableFastRng64* rand,
+        NPar::TLocalExecutor* localExecutor,
+        TFold* fold) const;
+
+private:
+    ui32 SampleCount;
+    float TopRate;
+    float OtherRate;
+    const ui32 BlockSize = 8192;
+};
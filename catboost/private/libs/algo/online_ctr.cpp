@@ -9,13 +9,17 @@
 #include <catboost/libs/helpers/array_subset.h>
 #include <catboost/libs/helpers/exception.h>
 #include <catboost/libs/helpers/mem_usage.h>
+#include <catboost/libs/helpers/parallel_sort/parallel_sort.h>
 #include <catboost/libs/helpers/resource_constrained_executor.h>
 #include <catboost/libs/model/ctr_value_table.h>
 #include <catboost/libs/model/model.h>
 
 #include <library/cpp/threading/local_executor/local_executor.h>
 
+#include <util/digest/numeric.h>
 #include <util/generic/bitops.h>
+#include <util/generic/cast.h>
+#include <util/generic/xrange.h>
 #include <util/generic/utility.h>
 #include <util/system/mem_info.h>
 #include <util/thread/singleton.h>
@@ -727,6 +731,151 @@ void ComputeOnlineCTRs(
         NPar::TLocalExecutor::WAIT_COMPLETE);
 }
 
+namespace {
+    // Object indices grouped by partitions of their hash values.
+    // Objects have the same order inside a partition as in the source array.
+    struct THashPartitions {
+        TVector<ui32> ObjectIndices;
+        TVector<size_t> Offsets; // [partitionIdx], size is partitionCount + 1
+
+    public:
+        ui32 GetPartitionCount() const {
+            return SafeIntegerCast<ui32>(Offsets.size() - 1);
+        }
+
+        TConstArrayRef<ui32> GetPartition(ui32 partitionIdx) const {
+            return MakeArrayRef(ObjectIndices.data() + Offsets[partitionIdx], Offsets[partitionIdx + 1] - Offsets[partitionIdx]);
+        }
+    };
+}
+
+static inline ui32 GetHashPartitionIdx(ui64 hash, ui32 partitionCount) {
+    return IntHash(hash) % partitionCount;
+}
+
+static THashPartitions PartitionObjectsByHash(
+    TConstArrayRef<ui64> hashes,
+    ui32 partitionCount,
+    NPar::TLocalExecutor* localExecutor) {
+
+    NPar::TLocalExecutor::TExecRangeParams blockParams(0, SafeIntegerCast<int>(hashes.size()));
+    blockParams.SetBlockCount(localExecutor->GetThreadCount() + 1);
+    const int blockCount = blockParams.GetBlockCount();
+    const auto getBlockRange = [&] (int blockIdx) {
+        const int blockBegin = blockParams.FirstId + blockIdx * blockParams.GetBlockSize();
+        return std::make_pair(blockBegin, Min(blockBegin + blockParams.GetBlockSize(), blockParams.LastId));
+    };
+
+    TVector<TVector<size_t>> writePositions(blockCount, TVector<size_t>(partitionCount, 0)); // [blockIdx][partitionIdx]
+    localExecutor->ExecRange(
+        [&] (int blockIdx) {
+            const auto [blockBegin, blockEnd] = getBlockRange(blockIdx);
+            auto& counts = writePositions[blockIdx];
+            for (int objectIdx = blockBegin; objectIdx < blockEnd; ++objectIdx) {
+                ++counts[GetHashPartitionIdx(hashes[objectIdx], partitionCount)];
+            }
+        },
+        0,
+        blockCount,
+        NPar::TLocalExecutor::WAIT_COMPLETE);
+
+    THashPartitions result;
+    result.Offsets.yresize(partitionCount + 1);
+    size_t offset = 0;
+    for (auto partitionIdx : xrange(partitionCount)) {
+        result.Offsets[partitionIdx] = offset;
+        for (auto blockIdx : xrange(blockCount)) {
+            const size_t count = writePositions[blockIdx][partitionIdx];
+            writePositions[blockIdx][partitionIdx] = offset;
+            offset += count;
+        }
+    }
+    result.Offsets[partitionCount] = offset;
+
+    result.ObjectIndices.yresize(hashes.size());
+    localExecutor->ExecRange(
+        [&] (int blockIdx) {
+            const auto [blockBegin, blockEnd] = getBlockRange(blockIdx);
+            auto& positions = writePositions[blockIdx];
+            for (int objectIdx = blockBegin; objectIdx < blockEnd; ++objectIdx) {
+                const ui32 partitionIdx = GetHashPartitionIdx(hashes[objectIdx], partitionCount);
+                result.ObjectIndices[positions[partitionIdx]++] = objectIdx;
+            }
+        },
+        0,
+        blockCount,
+        NPar::TLocalExecutor::WAIT_COMPLETE);
+    return result;
+}
+
+/// Parallel version of ComputeReindexHash without leaf count limit.
+/// Partitions are reindexed independently, resulting indices are the same as in ComputeReindexHash,
+/// i.e. assigned in order of the first occurrence of hash values.
+/// @return reindex hashes for each partition
+static TVector<TDenseHash<ui64, ui32>> ComputeReindexHashByPartitions(
+    const THashPartitions& partitions,
+    TArrayRef<ui64> hashArr,
+    NPar::TLocalExecutor* localExecutor) {
+
+    const ui32 partitionCount = partitions.GetPartitionCount();
+    TVector<TDenseHash<ui64, ui32>> reindexHashes(partitionCount);
+    TVector<TVector<ui32>> firstObjectIndices(partitionCount); // [partitionIdx][localIdx]
+    localExecutor->ExecRange(
+        [&] (int partitionIdx) {
+            auto& reindexHash = reindexHashes[partitionIdx];
+            auto& firstIndices = firstObjectIndices[partitionIdx];
+            for (ui32 objectIdx : partitions.GetPartition(partitionIdx)) {
+                auto p = reindexHash.emplace(hashArr[objectIdx], (ui32)firstIndices.size());
+                if (p.second) {
+                    firstIndices.push_back(objectIdx);
+                }
+                hashArr[objectIdx] = p.first->second;
+            }
+        },
+        0,
+        SafeIntegerCast<int>(partitionCount),
+        NPar::TLocalExecutor::WAIT_COMPLETE);
+
+    TVector<ui32> sortedFirstObjectIndices;
+    for (const auto& firstIndices : firstObjectIndices) {
+        sortedFirstObjectIndices.insert(sortedFirstObjectIndices.end(), firstIndices.begin(), firstIndices.end());
+    }
+    NCB::ParallelMergeSort(
+        [] (ui32 lhs, ui32 rhs) { return lhs < rhs; },
+        &sortedFirstObjectIndices,
+        localExecutor);
+
+    localExecutor->ExecRange(
+        [&] (int partitionIdx) {
+            auto& firstIndices = firstObjectIndices[partitionIdx];
+            for (auto& index : firstIndices) {
+                index = LowerBound(sortedFirstObjectIndices.begin(), sortedFirstObjectIndices.end(), index)
+                    - sortedFirstObjectIndices.begin();
+            }
+            for (ui32 objectIdx : partitions.GetPartition(partitionIdx)) {
+                hashArr[objectIdx] = firstIndices[hashArr[objectIdx]];
+            }
+            for (auto& it : reindexHashes[partitionIdx]) {
+                it.second = firstIndices[it.second];
+            }
+        },
+        0,
+        SafeIntegerCast<int>(partitionCount),
+        NPar::TLocalExecutor::WAIT_COMPLETE);
+    return reindexHashes;
+}
+
+static bool UsePartitionedFinalCtrs(
+    ui64 ctrLeafCountLimit,
+    ui32 totalSampleCount,
+    int threadCount,
+    ui32 minObjectCountForPartitioning = MinObjectCountForPartitionedFinalCtrs) {
+
+    return (threadCount > 1)
+        && (totalSampleCount >= minObjectCountForPartitioning)
+        && (ctrLeafCountLimit > totalSampleCount);
+}
+
 void CalcFinalCtrsImpl(
     const ECtrType ctrType,
     const ui64 ctrLeafCountLimit,
@@ -735,12 +884,28 @@ void CalcFinalCtrsImpl(
     const ui32 totalSampleCount,
     int targetClassesCount,
     TVector<ui64>* hashArr,
-    TCtrValueTable* result) {
+    TCtrValueTable* result,
+    NPar::TLocalExecutor* localExecutor,
+    ui32 minObjectCountForPartitioning) {
 
     Y_ASSERT(hashArr->size() == (size_t)totalSampleCount);
 
+    TMaybe<THashPartitions> partitions;
     size_t leafCount = 0;
-    {
+    const int threadCount = localExecutor->GetThreadCount() + 1;
+    if (UsePartitionedFinalCtrs(ctrLeafCountLimit, totalSampleCount, threadCount, minObjectCountForPartitioning)) {
+        partitions = PartitionObjectsByHash(*hashArr, threadCount, localExecutor);
+        const auto reindexHashes = ComputeReindexHashByPartitions(*partitions, *hashArr, localExecutor);
+        for (const auto& reindexHash : reindexHashes) {
+            leafCount += reindexHash.Size();
+        }
+        auto hashIndexBuilder = result->GetIndexHashBuilder(leafCount);
+        for (const auto& reindexHash : reindexHashes) {
+            for (const auto& kv : reindexHash) {
+                hashIndexBuilder.SetIndex(kv.first, kv.second);
+            }
+        }
+    } else {
         TDenseHash<ui64, ui32> tmpHash;
         leafCount = ComputeReindexHash(
             ctrLeafCountLimit,
@@ -768,7 +933,7 @@ void CalcFinalCtrsImpl(
 
     int targetBorderCount = targetClassesCount - 1;
     auto hashArrPtr = hashArr->data();
-    for (ui32 z = 0; z < totalSampleCount; ++z) {
+    const auto addObject = [&] (ui32 z) {
         const ui64 elemId = hashArrPtr[z];
         if (ctrType == ECtrType::BinarizedTargetMeanValue) {
             TCtrMeanHistory& elem = ctrMean[elemId];
@@ -784,6 +949,22 @@ void CalcFinalCtrsImpl(
                 targetClassesCount);
             ++elem[targetClass[z]];
         }
+    };
+    if (partitions) {
+        // objects with the same leaf are in the same partition and keep their relative order
+        localExecutor->ExecRange(
+            [&] (int partitionIdx) {
+                for (ui32 z : partitions->GetPartition(partitionIdx)) {
+                    addObject(z);
+                }
+            },
+            0,
+            SafeIntegerCast<int>(partitions->GetPartitionCount()),
+            NPar::TLocalExecutor::WAIT_COMPLETE);
+    } else {
+        for (ui32 z = 0; z < totalSampleCount; ++z) {
+            addObject(z);
+        }
     }
 
     if (ctrType == ECtrType::Counter) {
@@ -852,7 +1033,8 @@ static void CalcFinalCtrs(
         NeedTargetClassifier(ctrType) ?
             (**datasetDataForFinalCtrs.TargetClassesCount)[targetBorderClassifierIdx] : 0,
         &hashArr,
-        result
+        result,
+        localExecutor
     );
 }
 
@@ -861,7 +1043,8 @@ static ui64 EstimateCalcFinalCtrsCpuRamUsage(
     const TTrainingDataProviders& data,
     int targetClassesCount,
     ui64 ctrLeafCountLimit,
-    ECounterCalc counterCalcMethod) {
+    ECounterCalc counterCalcMethod,
+    int threadCount) {
 
     ui64 cpuRamUsageEstimate = 0;
 
@@ -872,8 +1055,22 @@ static ui64 EstimateCalcFinalCtrsCpuRamUsage(
     // for hashArr in CalcFinalCtrs
     cpuRamUsageEstimate += sizeof(ui64)*totalSampleCount;
 
-    ui64 reindexHashRamLimit =
-        sizeof(TDenseHash<ui64,ui32>::value_type)*FastClp2(totalSampleCount*2);
+    const bool usePartitions = UsePartitionedFinalCtrs(ctrLeafCountLimit, totalSampleCount, threadCount);
+
+    // for object indices grouped by hash partitions in CalcFinalCtrsImpl, alive during all stages
+    if (usePartitions) {
+        cpuRamUsageEstimate += sizeof(ui32)*totalSampleCount;
+    }
+
+    // sum of FastClp2(partitionSize*2) over partitions is less than totalSampleCount*4
+    ui64 reindexHashRamLimit = usePartitions ?
+        sizeof(TDenseHash<ui64,ui32>::value_type)*totalSampleCount*4
+        : sizeof(TDenseHash<ui64,ui32>::value_type)*FastClp2(totalSampleCount*2);
+
+    // indices of first occurrences of leaves for each partition, their sorted copy and merge sort buffer
+    if (usePartitions) {
+        reindexHashRamLimit += 3*sizeof(ui32)*totalSampleCount;
+    }
 
     // data for temporary vector to calc top
     ui64 computeReindexHashTopRamLimit = (ctrLeafCountLimit < totalSampleCount) ?
@@ -884,8 +1081,10 @@ static ui64 EstimateCalcFinalCtrsCpuRamUsage(
 
     ui64 reindexHashAfterComputeSizeLimit = Min<ui64>(ctrLeafCountLimit, totalSampleCount);
 
-    ui64 reindexHashAfterComputeRamLimit =
-        sizeof(TDenseHash<ui64,ui32>::value_type)*FastClp2(reindexHashAfterComputeSizeLimit*2);
+    // partitioned reindex hashes are kept as is while building the hash index
+    ui64 reindexHashAfterComputeRamLimit = usePartitions ?
+        sizeof(TDenseHash<ui64,ui32>::value_type)*totalSampleCount*4
+        : sizeof(TDenseHash<ui64,ui32>::value_type)*FastClp2(reindexHashAfterComputeSizeLimit*2);
 
 
     ui64 indexBucketsRamLimit = (sizeof(NCatboost::TBucket) *
@@ -981,7 +1180,8 @@ void CalcFinalCtrsAndSaveToModel(
                             (**datasetDataForFinalCtrs.TargetClassesCount)[ctr.TargetBorderClassifierIdx]
                             : 0,
                         ctrLeafCountLimit,
-                        counterCalcMethod
+                        counterCalcMethod,
+                        localExecutor->GetThreadCount() + 1
                     ),
                     [&asyncCtrValueTableCallback, &ctrTableGenerator, &ctr] () {
                         auto table = ctrTableGenerator(ctr);
@@ -68,6 +68,24 @@ void ComputeOnlineCTRs(
 );
 
 
+// used only if there is no leaf count limit and there are enough objects to benefit from parallelism
+constexpr ui32 MinObjectCountForPartitionedFinalCtrs = 100000;
+
+// exposed for unit tests
+void CalcFinalCtrsImpl(
+    ECtrType ctrType,
+    ui64 ctrLeafCountLimit,
+    const TVector<int>& targetClass,
+    TConstArrayRef<float> targets,
+    ui32 totalSampleCount,
+    int targetClassesCount,
+    TVector<ui64>* hashArr,
+    TCtrValueTable* result,
+    NPar::TLocalExecutor* localExecutor,
+    ui32 minObjectCountForPartitioning = MinObjectCountForPartitionedFinalCtrs
+);
+
+
 struct TDatasetDataForFinalCtrs {
     NCB::TTrainingDataProviders Data;
 
@@ -1,12 +1,14 @@
 #include "plot.h"
 
 #include "apply.h"
+#include "model_quantization_adapter.h"
 
 #include <catboost/libs/helpers/matrix.h>
 #include <catboost/libs/loggers/catboost_logger_helpers.h>
 #include <catboost/libs/loggers/logger.h>
 #include <catboost/libs/logging/logging.h>
 #include <catboost/libs/model/model.h>
+#include <catboost/libs/model/cpu/quantization.h>
 #include <catboost/private/libs/options/json_helper.h>
 
 #include <library/cpp/threading/local_executor/local_executor.h>
@@ -112,10 +114,122 @@ void TMetricsPlotCalcer::Append(
     };
 }
 
+static void InitBlockGroupInfos(
+    TConstArrayRef<TQueryInfo> groupInfos,
+    ui32 blockBegin,
+    ui32 minBlockEnd,
+    size_t* groupIdx,
+    TVector<TQueryInfo>* blockGroupInfos
+) {
+    blockGroupInfos->clear();
+    for (; *groupIdx < groupInfos.size() && groupInfos[*groupIdx].Begin < minBlockEnd; ++*groupIdx) {
+        blockGroupInfos->push_back(groupInfos[*groupIdx]);
+        blockGroupInfos->back().Begin -= blockBegin;
+        blockGroupInfos->back().End -= blockBegin;
+    }
+}
+
+/*
+ * Documents are processed in blocks that go through all plot iterations before the next block is taken,
+ * so quantized features and running approxes of a block stay in cache and the dataset is read only once.
+ * Each iteration evaluates only trees added since the previous one.
+ */
 TMetricsPlotCalcer& TMetricsPlotCalcer::ProceedDataSetForAdditiveMetrics(
     const TProcessedDataProvider& processedData
 ) {
-    ProceedDataSet(processedData, 0, Iterations.ysize(), /*isAdditiveMetrics=*/true);
+    const ui32 docCount = processedData.ObjectsData->GetObjectCount();
+    const int approxDimension = Model.GetDimensionsCount();
+    const auto target = processedData.TargetData->GetTarget();
+    const auto weights = GetWeights(*processedData.TargetData);
+    const auto groupInfos = processedData.TargetData->GetGroupInfo().GetOrElse(TConstArrayRef<TQueryInfo>());
+    const auto baseline = processedData.TargetData->GetBaseline();
+    const auto modelEvaluator = Model.GetCurrentEvaluator();
+
+    const ui32 subBlockSize = ui32(NModelEvaluation::FORMULA_EVALUATION_BLOCK_SIZE * 64);
+    const ui32 blockSize = subBlockSize * (Executor.GetThreadCount() + 1);
+
+    TVector<TIntrusivePtr<NModelEvaluation::IQuantizedData>> quantizedSubBlocks;
+    TVector<double> iterationApproxFlat;
+    TVector<TVector<double>> blockApprox(approxDimension);
+    TVector<TConstArrayRef<float>> blockTarget;
+    TVector<TQueryInfo> blockGroupInfos;
+    size_t groupIdx = 0;
+    for (ui32 blockBegin = 0; blockBegin < docCount;) {
+        ui32 blockEnd = Min(docCount, blockBegin + blockSize);
+        if (!groupInfos.empty()) {
+            // groups are not split between blocks
+            InitBlockGroupInfos(groupInfos, blockBegin, blockEnd, &groupIdx, &blockGroupInfos);
+            blockEnd = blockBegin + blockGroupInfos.back().End;
+        }
+        const ui32 blockDocCount = blockEnd - blockBegin;
+
+        const int subBlockCount = (blockDocCount + subBlockSize - 1) / subBlockSize;
+        quantizedSubBlocks.resize(subBlockCount);
+        Executor.ExecRangeWithThrow(
+            [&](int subBlockId) {
+                const ui32 subBlockBegin = blockBegin + subBlockId * subBlockSize;
+                const ui32 subBlockEnd = Min(blockEnd, subBlockBegin + subBlockSize);
+                quantizedSubBlocks[subBlockId] = MakeQuantizedFeaturesForEvaluator(
+                    Model,
+                    *processedData.ObjectsData,
+                    subBlockBegin,
+                    subBlockEnd);
+            },
+            0,
+            subBlockCount,
+            NPar::TLocalExecutor::WAIT_COMPLETE);
+
+        for (auto dim : xrange(approxDimension)) {
+            if (baseline) {
+                const auto baselinePart = (*baseline)[dim];
+                blockApprox[dim].assign(baselinePart.begin() + blockBegin, baselinePart.begin() + blockEnd);
+            } else {
+                blockApprox[dim].assign(blockDocCount, 0.0);
+            }
+        }
+        blockTarget.clear();
+        if (target) {
+            for (const auto& targetPart : *target) {
+                blockTarget.push_back(targetPart.Slice(blockBegin, blockDocCount));
+            }
+        }
+        const auto blockWeights = weights.empty() ? weights : weights.Slice(blockBegin, blockDocCount);
+
+        iterationApproxFlat.yresize(blockDocCount * approxDimension);
+        ui32 begin = 0;
+        for (ui32 iterationIndex = 0; iterationIndex < Iterations.size(); ++iterationIndex) {
+            const ui32 end = Iterations[iterationIndex] + 1;
+            Executor.ExecRangeWithThrow(
+                [&](int subBlockId) {
+                    const ui32 subBlockBegin = subBlockId * subBlockSize;
+                    const ui32 subBlockEnd = Min(blockDocCount, subBlockBegin + subBlockSize);
+                    modelEvaluator->Calc(
+                        quantizedSubBlocks[subBlockId].Get(),
+                        begin,
+                        end,
+                        MakeArrayRef(
+                            iterationApproxFlat.data() + subBlockBegin * approxDimension,
+                            (subBlockEnd - subBlockBegin) * approxDimension));
+                    for (ui32 doc = subBlockBegin; doc < subBlockEnd; ++doc) {
+                        for (auto dim : xrange(approxDimension)) {
+                            blockApprox[dim][doc] += iterationApproxFlat[doc * approxDimension + dim];
+                        }
+                    }
+                },
+                0,
+                subBlockCount,
+                NPar::TLocalExecutor::WAIT_COMPLETE);
+
+            ComputeAdditiveMetric(
+                blockApprox,
+                TConstArrayRef<TConstArrayRef<float>>(blockTarget),
+                blockWeights,
+                blockGroupInfos,
+                iterationIndex);
+            begin = end;
+        }
+        blockBegin = blockEnd;
+    }
     return *this;
 }
 
@@ -152,7 +266,7 @@ TMetricsPlotCalcer& TMetricsPlotCalcer::ProceedDataSetForNonAdditiveMetrics(
     }
     ui32 begin = ProcessedIterationsCount;
     ui32 end = Min<ui32>(ProcessedIterationsCount + ProcessedIterationsStep, Iterations.size());
-    ProceedDataSet(processedData, begin, end, /*isAdditiveMetrics=*/false);
+    ProceedDataSet(processedData, begin, end);
     return *this;
 }
 
@@ -235,8 +349,7 @@ static void ClearApproxBuffer(TVector<TVector<double>>* approxMatrix) {
 TMetricsPlotCalcer& TMetricsPlotCalcer::ProceedDataSet(
     const TProcessedDataProvider& processedData,
     ui32 beginIterationIndex,
-    ui32 endIterationIndex,
-    bool isAdditiveMetrics
+    ui32 endIterationIndex
 ) {
     TModelCalcerOnPool modelCalcerOnPool(Model, processedData.ObjectsData, &Executor);
 
@@ -256,10 +369,6 @@ TMetricsPlotCalcer& TMetricsPlotCalcer::ProceedDataSet(
         Load(docCount, LastApproxes.Get(), &CurApproxBuffer);
     }
 
-    const auto target = *processedData.TargetData->GetTarget();
-    const auto weights = GetWeights(*processedData.TargetData);
-    const auto groupInfos = processedData.TargetData->GetGroupInfo().GetOrElse(TConstArrayRef<TQueryInfo>());
-
     for (ui32 iterationIndex = beginIterationIndex; iterationIndex < endIterationIndex; ++iterationIndex) {
         end = Iterations[iterationIndex] + 1;
         modelCalcerOnPool.ApplyModelMulti(
@@ -269,17 +378,7 @@ TMetricsPlotCalcer& TMetricsPlotCalcer::ProceedDataSet(
             &FlatApproxBuffer,
             &NextApproxBuffer);
         Append(NextApproxBuffer, 0, &CurApproxBuffer);
-
-        if (isAdditiveMetrics) {
-            ComputeAdditiveMetric(
-                CurApproxBuffer,
-                target,
-                weights,
-                groupInfos,
-                iterationIndex);
-        } else {
-            SaveApproxToFile(iterationIndex, CurApproxBuffer);
-        }
+        SaveApproxToFile(iterationIndex, CurApproxBuffer);
         begin = end;
     }
     ClearApproxBuffer(&CurApproxBuffer);
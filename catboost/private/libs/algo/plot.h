@@ -77,8 +77,7 @@ private:
     TMetricsPlotCalcer& ProceedDataSet(
         const NCB::TProcessedDataProvider& processedData,
         ui32 beginIterationIndex,
-        ui32 endIterationIndex,
-        bool isAdditive
+        ui32 endIterationIndex
     );
 
     template <class TOutput>
@@ -486,6 +486,18 @@ void Bootstrap(
                 sampler.GenSampleWeights(boostingType, leafValues, rand, localExecutor, fold);
             }
             break;
+        case EBootstrapType::GOSS: {
+            CB_ENSURE(
+                samplingUnit != ESamplingUnit::Group,
+                "GOSS bootstrap is not implemented for groupwise sampling (sampling_unit=Group)"
+            );
+            CB_ENSURE(!isPairwiseScoring, "GOSS bootstrap is not supported for pairwise scoring");
+            performRandomChoice = false;
+            const float gossTopRate = params.ObliviousTreeOptions->BootstrapConfig->GetGossTopRate();
+            TGossSampler sampler(learnSampleCount, gossTopRate, takenFraction);
+            sampler.GenSampleWeights(boostingType, rand, localExecutor, fold);
+            break;
+        }
         case EBootstrapType::No:
             if (!isPairwiseScoring) {
                 Fill(fold->SampleWeights.begin(), fold->SampleWeights.end(), 1);
@@ -0,0 +1,124 @@
+#include <catboost/private/libs/algo/approx_calcer.h>
+#include <catboost/private/libs/algo_helpers/approx_calcer_helpers.h>
+#include <catboost/private/libs/algo_helpers/error_functions.h>
+#include <catboost/private/libs/options/restrictions.h>
+
+#include <library/cpp/testing/unittest/registar.h>
+#include <library/cpp/threading/local_executor/local_executor.h>
+
+#include <util/generic/xrange.h>
+#include <util/random/fast.h>
+
+#include <cmath>
+
+
+namespace {
+    // hides the type of the wrapped calcer, so CalcLeafDers takes its generic path
+    class TGenericDerCalcer final : public IDerCalcer {
+    public:
+        explicit TGenericDerCalcer(const IDerCalcer& error)
+            : IDerCalcer(error.GetIsExpApprox())
+            , Error(error)
+        {
+        }
+
+        void CalcDersRange(
+            int start,
+            int count,
+            bool calcThirdDer,
+            const double* approxes,
+            const double* approxDeltas,
+            const float* targets,
+            const float* weights,
+            TDers* ders
+        ) const override {
+            Error.CalcDersRange(start, count, calcThirdDer, approxes, approxDeltas, targets, weights, ders);
+        }
+
+    private:
+        const IDerCalcer& Error;
+    };
+}
+
+static TVector<TSum> CalcLeafSums(
+    TConstArrayRef<TIndexType> indices,
+    TConstArrayRef<float> targets,
+    TConstArrayRef<float> weights,
+    TConstArrayRef<double> approxes,
+    TConstArrayRef<double> approxesDelta,
+    const IDerCalcer& error,
+    int leafCount,
+    ELeavesEstimation estimationMethod,
+    NPar::TLocalExecutor* localExecutor) {
+    TVector<TSum> leafDers(leafCount);
+    TVector<TDers> scratchDers(APPROX_BLOCK_SIZE * CB_THREAD_LIMIT);
+    CalcLeafDers(
+        indices,
+        targets,
+        weights,
+        approxes,
+        approxesDelta,
+        error,
+        static_cast<int>(indices.size()),
+        /*recalcLeafWeights*/ true,
+        estimationMethod,
+        localExecutor,
+        leafDers,
+        scratchDers);
+    return leafDers;
+}
+
+static void CheckFusedLeafDers(const IDerCalcer& error, bool isBinaryTarget) {
+    const int sampleCount = 20000;
+    const int leafCount = 16;
+
+    TFastRng64 rng(0);
+    TVector<TIndexType> indices(sampleCount);
+    TVector<float> targets(sampleCount);
+    TVector<float> weights(sampleCount);
+    TVector<double> approxes(sampleCount);
+    TVector<double> approxesDelta(sampleCount);
+    for (auto i : xrange(sampleCount)) {
+        indices[i] = rng.Uniform(leafCount);
+        targets[i] = isBinaryTarget ? rng.Uniform(2) : 10 * rng.GenRandReal1() - 5;
+        weights[i] = rng.Uniform(3) == 0 ? 0.0f : 2 * rng.GenRandReal1();
+        approxes[i] = 4 * rng.GenRandReal1() - 2;
+        approxesDelta[i] = rng.GenRandReal1() - 0.5;
+        if (error.GetIsExpApprox()) {
+            approxes[i] = std::exp(approxes[i]);
+            approxesDelta[i] = std::exp(approxesDelta[i]);
+        }
+    }
+
+    NPar::TLocalExecutor localExecutor;
+    localExecutor.RunAdditionalThreads(3);
+
+    const TGenericDerCalcer genericError(error);
+    for (bool useWeights : {false, true}) {
+        for (bool useDelta : {false, true}) {
+            for (auto estimationMethod : {ELeavesEstimation::Newton, ELeavesEstimation::Gradient}) {
+                const TConstArrayRef<float> sampleWeights = useWeights ? TConstArrayRef<float>(weights) : TConstArrayRef<float>();
+                const TConstArrayRef<double> sampleDeltas = useDelta ? TConstArrayRef<double>(approxesDelta) : TConstArrayRef<double>();
+                const auto fused = CalcLeafSums(
+                    indices, targets, sampleWeights, approxes, sampleDeltas, error, leafCount, estimationMethod, &localExecutor);
+                const auto generic = CalcLeafSums(
+                    indices, targets, sampleWeights, approxes, sampleDeltas, genericError, leafCount, estimationMethod, &localExecutor);
+                for (auto leaf : xrange(leafCount)) {
+                    UNIT_ASSERT_VALUES_EQUAL(fused[leaf].SumDer, generic[leaf].SumDer);
+                    UNIT_ASSERT_VALUES_EQUAL(fused[leaf].SumDer2, generic[leaf].SumDer2);
+                    UNIT_ASSERT_VALUES_EQUAL(fused[leaf].SumWeights, generic[leaf].SumWeights);
+                }
+            }
+        }
+    }
+}
+
+Y_UNIT_TEST_SUITE(LeafDers) {
+    Y_UNIT_TEST(FusedRMSEMatchesGeneric) {
+        CheckFusedLeafDers(TRMSEError(/*isExpApprox*/ false), /*isBinaryTarget*/ false);
+    }
+
+    Y_UNIT_TEST(FusedLoglossMatchesGeneric) {
+        CheckFusedLeafDers(TCrossEntropyError(/*isExpApprox*/ true), /*isBinaryTarget*/ true);
+    }
+}
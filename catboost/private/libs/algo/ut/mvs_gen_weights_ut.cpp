@@ -126,4 +126,131 @@ Y_UNIT_TEST_SUITE(mvs) {
             }
         }
     }
+
+    Y_UNIT_TEST(goss_GenWeights) {
+        const ui32 SampleCount = CB_THREAD_LIMIT * 20;
+        TFold ff;
+        ff.SampleWeights.resize(SampleCount, 1);
+
+        const int SampleCountAsInt = SafeIntegerCast<int>(SampleCount);
+
+        TFold::TBodyTail bt(0, 0, SampleCountAsInt, SampleCountAsInt, (double)SampleCountAsInt);
+
+        bt.WeightedDerivatives.resize(1, TVector<double>(SampleCount));
+        bt.Approx.resize(1, TVector<double>(SampleCount));
+
+        for (ui32 j = 0; j < CB_THREAD_LIMIT; ++j) {
+            for (ui32 i = 0; i < 20; ++i) {
+                bt.WeightedDerivatives[0][20 * j + i] = (i % 2 ? -1.0 : 1.0) * i;
+            }
+        }
+
+        ff.BodyTailArr.emplace_back(std::move(bt));
+
+        const EBoostingType boostingType = Plain;
+        NPar::TLocalExecutor executor;
+        executor.RunAdditionalThreads(1);
+
+        TGossSampler sampler(SampleCount, 0.25, 0.5);
+
+        TRestorableFastRng64 rand(0);
+        sampler.GenSampleWeights(boostingType, &rand, &executor, &ff);
+
+        for (ui32 j = 0; j < CB_THREAD_LIMIT; ++j) {
+            for (ui32 i = 0; i < 20; ++i) {
+                const double weight = ff.SampleWeights[j * 20 + i];
+                if (i >= 15) {
+                    UNIT_ASSERT_DOUBLES_EQUAL(weight, 1.0, 1e-6);
+                } else {
+                    UNIT_ASSERT(Abs(weight - 2.0) < 1e-6 || Abs(weight) < 1e-6);
+                }
+            }
+        }
+    }
+
+    Y_UNIT_TEST(goss_GenWeights_multidimensional) {
+        const ui32 SampleCount = CB_THREAD_LIMIT * 20;
+        const int ApproxDimension = 2;
+        const float TopRate = 0.1;
+        const float OtherRate = 0.3;
+        TFold ff;
+        ff.SampleWeights.resize(SampleCount, 1);
+
+        const int SampleCountAsInt = SafeIntegerCast<int>(SampleCount);
+
+        TFold::TBodyTail bt(0, 0, SampleCountAsInt, SampleCountAsInt, (double)SampleCountAsInt);
+
+        bt.WeightedDerivatives.resize(ApproxDimension, TVector<double>(SampleCount));
+        bt.Approx.resize(ApproxDimension, TVector<double>(SampleCount));
+
+        // squared gradient norms are distinct, object i has rank i
+        for (ui32 i = 0; i < SampleCount; ++i) {
+            bt.WeightedDerivatives[0][i] = (i % 2 ? -1.0 : 1.0) * i;
+            bt.WeightedDerivatives[1][i] = 0.5 * i;
+        }
+
+        ff.BodyTailArr.emplace_back(std::move(bt));
+
+        const EBoostingType boostingType = Plain;
+        NPar::TLocalExecutor executor;
+        executor.RunAdditionalThreads(3);
+
+        TGossSampler sampler(SampleCount, TopRate, OtherRate);
+
+        TRestorableFastRng64 rand(0);
+        sampler.GenSampleWeights(boostingType, &rand, &executor, &ff);
+
+        const ui32 topCount = static_cast<ui32>(TopRate * SampleCount);
+        ui32 otherTakenCount = 0;
+        for (ui32 i = 0; i < SampleCount; ++i) {
+            const double weight = ff.SampleWeights[i];
+            if (i >= SampleCount - topCount) {
+                UNIT_ASSERT_DOUBLES_EQUAL(weight, 1.0, 1e-6);
+            } else if (Abs(weight) > 1e-6) {
+                UNIT_ASSERT_DOUBLES_EQUAL(weight, 1.0 / OtherRate, 1e-5);
+                ++otherTakenCount;
+            }
+        }
+        const double otherTakenFraction = (double)otherTakenCount / (SampleCount - topCount);
+        UNIT_ASSERT_DOUBLES_EQUAL(otherTakenFraction, OtherRate, 0.05);
+    }
+
+    Y_UNIT_TEST(goss_GenWeights_constantGradients) {
+        const ui32 SampleCount = CB_THREAD_LIMIT * 20;
+        const float TopRate = 0.2;
+        const float OtherRate = 0.5;
+        TFold ff;
+        ff.SampleWeights.resize(SampleCount, 1);
+
+        const int SampleCountAsInt = SafeIntegerCast<int>(SampleCount);
+
+        TFold::TBodyTail bt(0, 0, SampleCountAsInt, SampleCountAsInt, (double)SampleCountAsInt);
+
+        // as on the first Logloss iteration from zero approx: all squared gradients tie
+        bt.WeightedDerivatives.resize(1, TVector<double>(SampleCount, 0.5));
+        bt.Approx.resize(1, TVector<double>(SampleCount));
+
+        ff.BodyTailArr.emplace_back(std::move(bt));
+
+        const EBoostingType boostingType = Plain;
+        NPar::TLocalExecutor executor;
+        executor.RunAdditionalThreads(3);
+
+        TGossSampler sampler(SampleCount, TopRate, OtherRate);
+
+        TRestorableFastRng64 rand(0);
+        sampler.GenSampleWeights(boostingType, &rand, &executor, &ff);
+
+        const ui32 topCount = static_cast<ui32>(TopRate * SampleCount);
+        ui32 weightOneCount = 0;
+        for (ui32 i = 0; i < SampleCount; ++i) {
+            const double weight = ff.SampleWeights[i];
+            if (Abs(weight - 1.0) < 1e-6) {
+                ++weightOneCount;
+            } else {
+                UNIT_ASSERT(Abs(weight - 1.0 / OtherRate) < 1e-6 || Abs(weight) < 1e-6);
+            }
+        }
+        UNIT_ASSERT_VALUES_EQUAL(weightOneCount, topCount);
+    }
 }
@@ -0,0 +1,106 @@
+#include <catboost/private/libs/algo/online_ctr.h>
+
+#include <catboost/libs/model/ctr_value_table.h>
+
+#include <library/cpp/testing/unittest/registar.h>
+#include <library/cpp/threading/local_executor/local_executor.h>
+
+#include <util/generic/vector.h>
+#include <util/generic/xrange.h>
+#include <util/random/fast.h>
+
+#include <limits>
+
+
+static TCtrValueTable CalcFinalCtrTable(
+    ECtrType ctrType,
+    const TVector<ui64>& hashes,
+    const TVector<int>& targetClass,
+    const TVector<float>& targets,
+    int targetClassesCount,
+    ui32 minObjectCountForPartitioning,
+    NPar::TLocalExecutor* localExecutor
+) {
+    TVector<ui64> hashArr = hashes;
+    TCtrValueTable table;
+    CalcFinalCtrsImpl(
+        ctrType,
+        std::numeric_limits<ui64>::max(),
+        targetClass,
+        targets,
+        hashArr.size(),
+        targetClassesCount,
+        &hashArr,
+        &table,
+        localExecutor,
+        minObjectCountForPartitioning
+    );
+    return table;
+}
+
+Y_UNIT_TEST_SUITE(FinalCtrs) {
+    Y_UNIT_TEST(PartitionedFinalCtrsMatchSequential) {
+        const ui32 objectCount = 20000;
+        const int targetClassesCount = 3;
+
+        TFastRng64 rng(0);
+        TVector<ui64> hashes(objectCount);
+        TVector<int> targetClass(objectCount);
+        TVector<float> targets(objectCount);
+        for (auto i : xrange(objectCount)) {
+            // a lot of repeated values with skewed frequencies
+            hashes[i] = rng.Uniform(1 + rng.Uniform(5000)) * 0x9E3779B97F4A7C15ull;
+            targetClass[i] = rng.Uniform(targetClassesCount);
+            targets[i] = rng.GenRandReal1();
+        }
+
+        NPar::TLocalExecutor localExecutor;
+        localExecutor.RunAdditionalThreads(3);
+
+        for (auto ctrType : {
+            ECtrType::Borders,
+            ECtrType::Buckets,
+            ECtrType::BinarizedTargetMeanValue,
+            ECtrType::FloatTargetMeanValue,
+            ECtrType::Counter,
+            ECtrType::FeatureFreq
+        }) {
+            const auto sequential = CalcFinalCtrTable(
+                ctrType,
+                hashes,
+                targetClass,
+                targets,
+                targetClassesCount,
+                /*minObjectCountForPartitioning*/ objectCount + 1,
+                &localExecutor
+            );
+            const auto partitioned = CalcFinalCtrTable(
+                ctrType,
+                hashes,
+                targetClass,
+                targets,
+                targetClassesCount,
+                /*minObjectCountForPartitioning*/ 0,
+                &localExecutor
+            );
+
+            UNIT_ASSERT_VALUES_EQUAL(sequential.CounterDenominator, partitioned.CounterDenominator);
+            UNIT_ASSERT_VALUES_EQUAL(sequential.TargetClassesCount, partitioned.TargetClassesCount);
+
+            // leaves are indexed in order of first occurrence in both cases, so blobs are identical
+            const auto sequentialBlob = sequential.GetTypedArrayRefForBlobData<ui8>();
+            const auto partitionedBlob = partitioned.GetTypedArrayRefForBlobData<ui8>();
+            UNIT_ASSERT_VALUES_EQUAL(sequentialBlob.size(), partitionedBlob.size());
+            UNIT_ASSERT(Equal(sequentialBlob.begin(), sequentialBlob.end(), partitionedBlob.begin()));
+
+            const auto sequentialIndex = sequential.GetIndexHashViewer();
+            const auto partitionedIndex = partitioned.GetIndexHashViewer();
+            UNIT_ASSERT_VALUES_EQUAL(sequentialIndex.CountNonEmptyBuckets(), partitionedIndex.CountNonEmptyBuckets());
+            for (auto hash : hashes) {
+                const ui32 index = sequentialIndex.GetIndex(hash);
+                UNIT_ASSERT(index != NCatboost::TDenseIndexHashView::NotFoundIndex);
+                UNIT_ASSERT_VALUES_EQUAL(index, partitionedIndex.GetIndex(hash));
+            }
+        }
+    }
+}
@@ -9,6 +9,7 @@
 #include <catboost/libs/logging/logging.h>
 
 #include <library/cpp/getopt/small/last_getopt.h>
+#include <library/cpp/threading/future/future.h>
 
 #include <util/string/cast.h>
 #include <util/string/split.h>
@@ -210,6 +211,23 @@ void NCB::CalcModelSingleHost(
         32,
         static_cast<int>(10000. / (static_cast<double>(iterationsLimit) / evalPeriod) / model.GetDimensionsCount())
     );
+    const TExternalLabelsHelper visibleLabelsHelper(model);
+
+    // Output of the previous block is formatted and written on a separate thread
+    // while the current block is being evaluated
+    NPar::TLocalExecutor outputExecutor;
+    outputExecutor.RunAdditionalThreads(1);
+    NThreading::TFuture<void> outputFuture;
+    auto waitForOutput = [&outputFuture] () {
+        if (outputFuture.Initialized()) {
+            outputFuture.GetValueSync(); // will rethrow if there was an exception during output
+            outputFuture = NThreading::TFuture<void>();
+        }
+    };
+
+    // output warnings would be repeated for every block; logging settings are process-wide, so they are
+    // changed here for the whole pipeline and not on the output thread while blocks are read and evaluated
+    TSetLoggingSilent inThisScope;
     ReadAndProceedPoolInBlocks(
         params.DatasetReadingParams,
         blockSize,
@@ -218,27 +236,38 @@ void NCB::CalcModelSingleHost(
                 ValidateColumnOutput(params.OutputColumnsIds, *datasetPart);
             }
             auto approx = Apply(model, *datasetPart, 0, iterationsLimit, evalPeriod, virtualEnsemblesCount, params.IsUncertaintyPrediction, &executor);
-            const TExternalLabelsHelper visibleLabelsHelper(model);
-
-            poolColumnsPrinter->UpdateColumnTypeInfo(datasetPart->MetaInfo.ColumnsInfo);
-
-            TSetLoggingSilent inThisScope;
-            OutputEvalResultToFile(
-                approx,
-                &executor,
-                params.OutputColumnsIds,
-                model.GetLossFunctionName(),
-                visibleLabelsHelper,
-                *datasetPart,
-                outputStream.Get(),
-                // TODO: src file columns output is incompatible with block processing
-                poolColumnsPrinter,
-                /*testFileWhichOf*/ {0, 0},
-                IsFirstBlock,
-                docIdOffset,
-                std::make_pair(evalPeriod, iterationsLimit));
+
+            waitForOutput();
+            auto outputBlock = [&, datasetPart, approx = std::move(approx), isFirstBlock = IsFirstBlock, docIdOffset] (int) {
+                poolColumnsPrinter->UpdateColumnTypeInfo(datasetPart->MetaInfo.ColumnsInfo);
+
+                OutputEvalResultToFile(
+                    approx,
+                    &executor,
+                    params.OutputColumnsIds,
+                    model.GetLossFunctionName(),
+                    visibleLabelsHelper,
+                    *datasetPart,
+                    outputStream.Get(),
+                    // TODO: src file columns output is incompatible with block processing
+                    poolColumnsPrinter,
+                    /*testFileWhichOf*/ {0, 0},
+                    isFirstBlock,
+                    docIdOffset,
+                    std::make_pair(evalPeriod, iterationsLimit));
+            };
+            auto outputFutures = outputExecutor.ExecRangeWithFutures(
+                std::move(outputBlock),
+                0,
+                1,
+                NPar::TLocalExecutor::HIGH_PRIORITY
+            );
+            Y_VERIFY(outputFutures.size() == 1);
+            outputFuture = std::move(outputFutures[0]);
+
             docIdOffset += datasetPart->ObjectsGrouping->GetObjectCount();
             IsFirstBlock = false;
         },
         &executor);
+    waitForOutput();
 }
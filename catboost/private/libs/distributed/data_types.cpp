@@ -0,0 +1,95 @@
+#include "data_types.h"
+
+#include <catboost/libs/helpers/exception.h>
+
+#include <util/generic/cast.h>
+#include <util/generic/xrange.h>
+
+
+namespace NCatboostDistributed {
+
+    struct TCompactBucketStats {
+        float SumWeightedDelta;
+        float SumWeight;
+        float SumDelta;
+        float Count;
+    };
+
+    static inline bool IsEmptyBucket(const TBucketStats& bucket) {
+        return bucket.SumWeightedDelta == 0 && bucket.SumWeight == 0 && bucket.SumDelta == 0 && bucket.Count == 0;
+    }
+
+    static void SaveCompact(const TStats3D& stats3D, IBinSaver* binSaver) {
+        NCB::SaveMulti(binSaver, stats3D.BucketCount, stats3D.MaxLeafCount, stats3D.SplitEnsembleSpec);
+
+        TVector<ui32> nonEmptyIndices;
+        TVector<TCompactBucketStats> nonEmptyBuckets;
+        for (auto bucketIdx : xrange(stats3D.Stats.size())) {
+            const auto& bucket = stats3D.Stats[bucketIdx];
+            if (!IsEmptyBucket(bucket)) {
+                nonEmptyIndices.push_back(SafeIntegerCast<ui32>(bucketIdx));
+                nonEmptyBuckets.push_back(
+                    TCompactBucketStats{
+                        (float)bucket.SumWeightedDelta,
+                        (float)bucket.SumWeight,
+                        (float)bucket.SumDelta,
+                        (float)bucket.Count});
+            }
+        }
+        const ui64 bucketCount = stats3D.Stats.size();
+        const ui32 nonEmptyCount = SafeIntegerCast<ui32>(nonEmptyIndices.size());
+        NCB::SaveMulti(binSaver, bucketCount, nonEmptyCount);
+        NCB::SaveArrayData<ui32>(nonEmptyIndices, binSaver);
+        NCB::SaveArrayData<TCompactBucketStats>(nonEmptyBuckets, binSaver);
+    }
+
+    static void LoadCompact(IBinSaver* binSaver, TStats3D* stats3D) {
+        NCB::LoadMulti(binSaver, &stats3D->BucketCount, &stats3D->MaxLeafCount, &stats3D->SplitEnsembleSpec);
+
+        ui64 bucketCount = 0;
+        ui32 nonEmptyCount = 0;
+        NCB::LoadMulti(binSaver, &bucketCount, &nonEmptyCount);
+        TVector<ui32> nonEmptyIndices;
+        nonEmptyIndices.yresize(nonEmptyCount);
+        NCB::LoadArrayData<ui32>(nonEmptyIndices, binSaver);
+        TVector<TCompactBucketStats> nonEmptyBuckets;
+        nonEmptyBuckets.yresize(nonEmptyCount);
+        NCB::LoadArrayData<TCompactBucketStats>(nonEmptyBuckets, binSaver);
+
+        stats3D->Stats.clear();
+        stats3D->Stats.resize(bucketCount, TBucketStats{0, 0, 0, 0});
+        for (auto i : xrange(nonEmptyCount)) {
+            CB_ENSURE_INTERNAL(nonEmptyIndices[i] < bucketCount, "Bucket index is out of range");
+            const auto& bucket = nonEmptyBuckets[i];
+            stats3D->Stats[nonEmptyIndices[i]] = TBucketStats{
+                bucket.SumWeightedDelta,
+                bucket.SumWeight,
+                bucket.SumDelta,
+                bucket.Count};
+        }
+    }
+
+    int TRemoteStats4D::operator&(IBinSaver& binSaver) {
+        binSaver.Add(0, &IsCompact);
+        if (!IsCompact) {
+            binSaver.Add(0, &Stats);
+            return 0;
+        }
+        if (binSaver.IsReading()) {
+            ui32 stats3DCount = 0;
+            NCB::LoadMulti(&binSaver, &stats3DCount);
+            Stats.resize(stats3DCount);
+            for (auto& stats3D : Stats) {
+                LoadCompact(&binSaver, &stats3D);
+            }
+        } else {
+            const ui32 stats3DCount = SafeIntegerCast<ui32>(Stats.size());
+            NCB::SaveMulti(&binSaver, stats3DCount);
+            for (const auto& stats3D : Stats) {
+                SaveCompact(stats3D, &binSaver);
+            }
+        }
+        return 0;
+    }
+
+} // NCatboostDistributed
@@ -41,6 +41,17 @@ namespace NCatboostDistributed {
     using TMultiSums = TVector<TSumMulti>;
 
     using TWorkerPairwiseStats = TVector<TVector<TPairwiseStats>>; // [cand][subCand]
+    using TCandidateVotes = TVector<int>; // indices of candidates voted for by a worker
+
+    // TStats4D as it is sent between hosts
+    // if IsCompact is set, empty buckets are skipped and nonempty ones are sent as floats
+    struct TRemoteStats4D {
+        TStats4D Stats;
+        bool IsCompact = false;
+
+    public:
+        int operator&(IBinSaver& binSaver);
+    };
 
     struct TTrainData : public IObjectBase {
         NCB::TTrainingDataProviders TrainData;
@@ -119,6 +130,9 @@ namespace NCatboostDistributed {
         TArray2D<double> PairwiseBuckets;
         int GradientIteration;
 
+        // local stats of all candidates from the last voting round, used by TRemoteVotedBinCalcer
+        TStats5D VotingStats;
+
         // Starting point for gradient walker
         TVector<TVector<double>> BacktrackingStart;
 
@@ -21,6 +21,7 @@
 #include <catboost/libs/helpers/vector_helpers.h>
 #include <catboost/private/libs/index_range/index_range.h>
 
+#include <util/generic/algorithm.h>
 #include <util/generic/ymath.h>
 
 #include <limits>
@@ -515,26 +516,32 @@ namespace NCatboostDistributed {
         auto calcStats3D = [&](const TCandidateInfo& candidate, TStats3D* stats3D) {
             CalcStats3D(trainData, candidate, stats3D);
         };
-        MapVector(calcStats3D, candidatesInfoList->Candidates, bucketStats);
+        MapVector(calcStats3D, candidatesInfoList->Candidates, &bucketStats->Stats);
+        bucketStats->IsCompact = TLocalTensorSearchData::GetRef().Params.SystemOptions->CompactDistributedStats;
     }
 
-    // vector<TStats4D> -> TStats4D
-    void TRemoteBinCalcer::DoReduce(TVector<TOutput>* statsFromAllWorkers, TOutput* stats) const {
-        const int workerCount = statsFromAllWorkers->ysize();
-        const int bucketCount = (*statsFromAllWorkers)[0].ysize();
-        stats->yresize(bucketCount);
+    static void ReduceRemoteStats4D(const TVector<TRemoteStats4D>& statsFromAllWorkers, TRemoteStats4D* stats) {
+        const int workerCount = statsFromAllWorkers.ysize();
+        const int bucketCount = statsFromAllWorkers[0].Stats.ysize();
+        stats->Stats.yresize(bucketCount);
+        stats->IsCompact = statsFromAllWorkers[0].IsCompact;
         NPar::ParallelFor(
             0,
             bucketCount,
             [&] (int bucketIdx) {
-                (*stats)[bucketIdx] = (*statsFromAllWorkers)[0][bucketIdx];
+                stats->Stats[bucketIdx] = statsFromAllWorkers[0].Stats[bucketIdx];
                 for (int workerIdx = 1; workerIdx < workerCount; ++workerIdx) {
-                    (*stats)[bucketIdx].Add((*statsFromAllWorkers)[workerIdx][bucketIdx]);
+                    stats->Stats[bucketIdx].Add(statsFromAllWorkers[workerIdx].Stats[bucketIdx]);
                 }
             });
     }
 
-    // TStats4D -> TVector<TVector<double>> [subcandidate][bucket]
+    // vector<TRemoteStats4D> -> TRemoteStats4D
+    void TRemoteBinCalcer::DoReduce(TVector<TOutput>* statsFromAllWorkers, TOutput* stats) const {
+        ReduceRemoteStats4D(*statsFromAllWorkers, stats);
+    }
+
+    // TRemoteStats4D -> TVector<TVector<double>> [subcandidate][bucket]
     void TRemoteScoreCalcer::DoMap(
         NPar::IUserContext* /*ctx*/,
         int /*hostId*/,
@@ -550,7 +557,70 @@ namespace NCatboostDistributed {
                                              localData.AllDocCount,
                                              localData.Params);
             };
-        MapVector(getScores, *bucketStats, scores);
+        MapVector(getScores, bucketStats->Stats, scores);
+    }
+
+    // TCandidateList -> indices of local top candidates
+    void TRemoteCandidateVoter::DoMap(
+        NPar::IUserContext* ctx,
+        int hostId,
+        TInput* candidateList,
+        TOutput* votedCandidates
+    ) const {
+        NPar::TCtxPtr<TTrainData> trainData(ctx, SHARED_ID_TRAIN_DATA, hostId);
+        auto& localData = TLocalTensorSearchData::GetRef();
+        auto calcStats3D = [&](const TCandidateInfo& candidate, TStats3D* stats3D) {
+            CalcStats3D(trainData, candidate, stats3D);
+        };
+        MapCandidateList(calcStats3D, *candidateList, &localData.VotingStats);
+
+        const auto getBestScore = [&] (const TVector<TStats3D>& candidateStats, double* bestScore) {
+            *bestScore = MINIMAL_SCORE;
+            for (const auto& stats3D : candidateStats) {
+                const auto scores = GetScores(
+                    stats3D,
+                    localData.Depth,
+                    localData.SumAllWeights,
+                    localData.AllDocCount,
+                    localData.Params);
+                for (double score : scores) {
+                    *bestScore = Max(*bestScore, score);
+                }
+            }
+        };
+        TVector<double> bestScores;
+        MapVector(getBestScore, localData.VotingStats, &bestScores);
+
+        const int candidateCount = bestScores.ysize();
+        const int voteCount = Min<int>(localData.Params.SystemOptions->VotingCandidateCount.Get(), candidateCount);
+        votedCandidates->yresize(candidateCount);
+        Iota(votedCandidates->begin(), votedCandidates->end(), 0);
+        PartialSort(
+            votedCandidates->begin(),
+            votedCandidates->begin() + voteCount,
+            votedCandidates->end(),
+            [&] (int lhs, int rhs) {
+                return bestScores[lhs] > bestScores[rhs] || (bestScores[lhs] == bestScores[rhs] && lhs < rhs);
+            });
+        votedCandidates->resize(voteCount);
+    }
+
+    // candidate index -> TRemoteStats4D
+    void TRemoteVotedBinCalcer::DoMap(
+        NPar::IUserContext* /*ctx*/,
+        int /*hostId*/,
+        TInput* candidateIdx,
+        TOutput* bucketStats
+    ) const {
+        const auto& localData = TLocalTensorSearchData::GetRef();
+        Y_ASSERT(*candidateIdx < localData.VotingStats.ysize());
+        bucketStats->Stats = localData.VotingStats[*candidateIdx];
+        bucketStats->IsCompact = localData.Params.SystemOptions->CompactDistributedStats;
+    }
+
+    // vector<TRemoteStats4D> -> TRemoteStats4D
+    void TRemoteVotedBinCalcer::DoReduce(TVector<TOutput>* statsFromAllWorkers, TOutput* stats) const {
+        ReduceRemoteStats4D(*statsFromAllWorkers, stats);
     }
 
     void TLeafIndexSetter::DoMap(
@@ -1046,6 +1116,8 @@ REGISTER_SAVELOAD_NM_CLASS(0xd66d584, NCatboostDistributed, TDerivativesStDevFro
 REGISTER_SAVELOAD_NM_CLASS(0xd66d485, NCatboostDistributed, TScoreCalcer);
 REGISTER_SAVELOAD_NM_CLASS(0xd66d585, NCatboostDistributed, TRemoteBinCalcer);
 REGISTER_SAVELOAD_NM_CLASS(0xd66d685, NCatboostDistributed, TRemoteScoreCalcer);
+REGISTER_SAVELOAD_NM_CLASS(0xd66d785, NCatboostDistributed, TRemoteCandidateVoter);
+REGISTER_SAVELOAD_NM_CLASS(0xd66d786, NCatboostDistributed, TRemoteVotedBinCalcer);
 REGISTER_SAVELOAD_NM_CLASS(0xd66d486, NCatboostDistributed, TLeafIndexSetter);
 REGISTER_SAVELOAD_NM_CLASS(0xd66d487, NCatboostDistributed, TEmptyLeafFinder);
 REGISTER_SAVELOAD_NM_CLASS(0xd66d488, NCatboostDistributed, TCalcApproxStarter);
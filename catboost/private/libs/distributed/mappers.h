@@ -84,15 +84,26 @@ namespace NCatboostDistributed {
         OBJECT_NOCOPY_METHODS(TRemotePairwiseScoreCalcer);
         void DoMap(NPar::IUserContext* ctx, int hostId, TInput* bucketStats, TOutput* scores) const final;
     };
-    class TRemoteBinCalcer: public NPar::TMapReduceCmd<TCandidatesInfoList, TStats4D> { // [subcand]
+    class TRemoteBinCalcer: public NPar::TMapReduceCmd<TCandidatesInfoList, TRemoteStats4D> { // [subcand]
         OBJECT_NOCOPY_METHODS(TRemoteBinCalcer);
         void DoMap(NPar::IUserContext* ctx, int hostId, TInput* candidatesInfoList, TOutput* bucketStats) const final;
         void DoReduce(TVector<TOutput>* statsFromAllWorkers, TOutput* bucketStats) const final;
     };
-    class TRemoteScoreCalcer: public NPar::TMapReduceCmd<TStats4D, TVector<TVector<double>>> {
+    class TRemoteScoreCalcer: public NPar::TMapReduceCmd<TRemoteStats4D, TVector<TVector<double>>> {
         OBJECT_NOCOPY_METHODS(TRemoteScoreCalcer);
         void DoMap(NPar::IUserContext* ctx, int hostId, TInput* bucketStats, TOutput* scores) const final;
     };
+    // [cand] -> local top candidates
+    class TRemoteCandidateVoter: public NPar::TMapReduceCmd<TCandidateList, TCandidateVotes> {
+        OBJECT_NOCOPY_METHODS(TRemoteCandidateVoter);
+        void DoMap(NPar::IUserContext* ctx, int hostId, TInput* candidateList, TOutput* votedCandidates) const final;
+    };
+    // voted candidate index -> TRemoteStats4D, stats are taken from the last voting round
+    class TRemoteVotedBinCalcer: public NPar::TMapReduceCmd<int, TRemoteStats4D> { // [subcand]
+        OBJECT_NOCOPY_METHODS(TRemoteVotedBinCalcer);
+        void DoMap(NPar::IUserContext* ctx, int hostId, TInput* candidateIdx, TOutput* bucketStats) const final;
+        void DoReduce(TVector<TOutput>* statsFromAllWorkers, TOutput* bucketStats) const final;
+    };
     class TLeafIndexSetter: public NPar::TMapReduceCmd<TSplit, TUnusedInitializedParam> {
         OBJECT_NOCOPY_METHODS(TLeafIndexSetter);
         void DoMap(
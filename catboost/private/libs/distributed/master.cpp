@@ -2,7 +2,9 @@
 #include "mappers.h"
 
 #include <catboost/libs/data/load_data.h>
+#include <catboost/libs/helpers/exception.h>
 #include <catboost/libs/helpers/quantile.h>
+#include <catboost/libs/logging/logging.h>
 #include <catboost/private/libs/algo/approx_calcer_helpers.h>
 #include <catboost/private/libs/algo/approx_calcer/gradient_walker.h>
 #include <catboost/private/libs/algo/approx_updater_helpers.h>
@@ -15,13 +17,24 @@
 #include <catboost/private/libs/options/json_helper.h>
 
 #include <library/cpp/par/par_settings.h>
-
+#include <library/cpp/threading/local_executor/local_executor.h>
+
+#include <util/datetime/base.h>
+#include <util/generic/algorithm.h>
+#include <util/generic/xrange.h>
+#include <util/network/socket.h>
+#include <util/stream/file.h>
+#include <util/string/cast.h>
+#include <util/system/mktemp.h>
+#include <util/system/tempfile.h>
 #include <util/system/yassert.h>
 
 
 using namespace NCatboostDistributed;
 using namespace NCB;
 
+static const TDuration WorkerConnectTimeout = TDuration::Seconds(10);
+
 struct TMasterEnvironment {
     TObj<NPar::IRootEnvironment> RootEnvironment = nullptr;
     TObj<NPar::IEnvironment> SharedTrainData = nullptr;
@@ -33,16 +46,100 @@ struct TMasterEnvironment {
     }
 };
 
+std::pair<TString, ui16> ParseWorkerHostAndPort(TStringBuf host, ui16 defaultPort) {
+    TStringBuf address = host;
+    TStringBuf port;
+    if (host.StartsWith('[')) {
+        const size_t addressEnd = host.find(']');
+        CB_ENSURE(addressEnd != TStringBuf::npos, "Invalid ipv6 worker address " << host);
+        address = host.SubStr(1, addressEnd - 1);
+        const TStringBuf rest = host.SubStr(addressEnd + 1);
+        if (!rest.empty()) {
+            CB_ENSURE(rest.StartsWith(':') && rest.size() > 1, "Invalid ipv6 worker address " << host);
+            port = rest.SubStr(1);
+        }
+    } else {
+        CB_ENSURE(
+            host.find(':') == host.rfind(':'),
+            "Worker address " << host << " has several ':', ipv6 addresses should be in brackets, e.g. [::1]:port");
+        host.Split(':', address, port);
+    }
+    CB_ENSURE(!address.empty(), "Empty worker address in " << host);
+    return {TString(address), port.empty() ? defaultPort : FromString<ui16>(port)};
+}
+
+static bool IsWorkerAvailable(const TString& host, const TString& address, ui16 port) {
+    try {
+        TSocket socket(TNetworkAddress(address, port), WorkerConnectTimeout);
+    } catch (const yexception& e) {
+        CATBOOST_WARNING_LOG << "Worker " << host << " is unavailable and will not be used: " << e.what() << Endl;
+        return false;
+    }
+    return true;
+}
+
+// Copy the hosts file without workers that do not accept connections at startup
+static void WriteAvailableWorkers(const TString& fileWithHosts, const TString& fileWithAvailableHosts) {
+    TVector<TString> hosts;
+    {
+        TFileInput hostsInput(fileWithHosts);
+        TString host;
+        while (hostsInput.ReadLine(host)) {
+            if (!host.empty()) {
+                hosts.push_back(host);
+            }
+        }
+    }
+    CB_ENSURE(!hosts.empty(), "No workers in " << fileWithHosts);
+    TVector<std::pair<TString, ui16>> addresses;
+    for (const auto& host : hosts) {
+        addresses.push_back(ParseWorkerHostAndPort(host, NCatboostOptions::TSystemOptions::GetUnusedNodePort()));
+    }
+
+    // probe all hosts at once, so that startup waits for at most one connect timeout
+    TVector<ui8> isAvailable(hosts.size(), false);
+    NPar::TLocalExecutor localExecutor;
+    localExecutor.RunAdditionalThreads(hosts.ysize() - 1);
+    localExecutor.ExecRange(
+        [&] (int hostIdx) {
+            isAvailable[hostIdx] = IsWorkerAvailable(
+                hosts[hostIdx],
+                addresses[hostIdx].first,
+                addresses[hostIdx].second);
+        },
+        0,
+        hosts.ysize(),
+        NPar::TLocalExecutor::WAIT_COMPLETE);
+
+    TFileOutput availableHostsOutput(fileWithAvailableHosts);
+    size_t availableHostCount = 0;
+    for (auto hostIdx : xrange(hosts.size())) {
+        if (isAvailable[hostIdx]) {
+            availableHostsOutput << hosts[hostIdx] << Endl;
+            ++availableHostCount;
+        }
+    }
+    CB_ENSURE(availableHostCount > 0, "No workers from " << fileWithHosts << " are available");
+}
+
 void InitializeMaster(const NCatboostOptions::TSystemOptions& systemOptions) {
     Y_ASSERT(systemOptions.IsMaster());
     const ui32 unusedNodePort = NCatboostOptions::TSystemOptions::GetUnusedNodePort();
 
+    TString fileWithHosts = systemOptions.FileWithHosts;
+    THolder<TTempFile> fileWithAvailableHosts;
+    if (systemOptions.SkipUnavailableWorkers) {
+        fileWithAvailableHosts = MakeHolder<TTempFile>(MakeTempName(nullptr, "hosts"));
+        WriteAvailableWorkers(fileWithHosts, fileWithAvailableHosts->Name());
+        fileWithHosts = fileWithAvailableHosts->Name();
+    }
+
     // avoid Netliba
     NPar::TParNetworkSettings::GetRef().RequesterType = NPar::TParNetworkSettings::ERequesterType::NEH;
     TMasterEnvironment::GetRef().RootEnvironment = NPar::RunMaster(
         systemOptions.NodePort,
         systemOptions.NumThreads,
-        systemOptions.FileWithHosts->c_str(),
+        fileWithHosts.c_str(),
         unusedNodePort,
         unusedNodePort);
     const int workerCount = TMasterEnvironment::GetRef().RootEnvironment->GetSlaveCount();
@@ -308,11 +405,111 @@ void MapRemotePairwiseCalcScore(
         ctx);
 }
 
+// Voting-parallel split search: each worker votes for its local top candidates
+// and only the most voted candidates get their statistics aggregated
+static void MapVotingRemoteCalcScore(
+    double scoreStDev,
+    TVector<TCandidatesContext>* candidatesContexts,
+    TLearnContext* ctx) {
+
+    Y_ASSERT(ctx->Params.SystemOptions->IsMaster());
+
+    TCandidateList allCandidatesList;
+    TVector<std::pair<int, int>> contextAndCandidateIdx; // [allCandidatesIdx]
+    for (auto contextIdx : xrange(candidatesContexts->ysize())) {
+        const auto& candidateList = (*candidatesContexts)[contextIdx].CandidateList;
+        for (auto candidateIdx : xrange(candidateList.ysize())) {
+            allCandidatesList.push_back(candidateList[candidateIdx]);
+            contextAndCandidateIdx.emplace_back(contextIdx, candidateIdx);
+        }
+    }
+
+    const int workerCount = TMasterEnvironment::GetRef().RootEnvironment->GetSlaveCount();
+    const auto votesFromAllWorkers = ApplyMapper<TRemoteCandidateVoter>(
+        workerCount,
+        TMasterEnvironment::GetRef().SharedTrainData,
+        allCandidatesList);
+    TVector<int> voteCounts(allCandidatesList.size(), 0);
+    for (const auto& votes : votesFromAllWorkers) {
+        for (int candidateIdx : votes) {
+            ++voteCounts[candidateIdx];
+        }
+    }
+
+    // as in PV-Tree, aggregate twice as many candidates as each worker votes for
+    TVector<int> votedCandidates;
+    for (auto candidateIdx : xrange(voteCounts.ysize())) {
+        if (voteCounts[candidateIdx] > 0) {
+            votedCandidates.push_back(candidateIdx);
+        }
+    }
+    const int votedCount = Min<int>(
+        2 * ctx->Params.SystemOptions->VotingCandidateCount.Get(),
+        votedCandidates.ysize());
+    PartialSort(
+        votedCandidates.begin(),
+        votedCandidates.begin() + votedCount,
+        votedCandidates.end(),
+        [&] (int lhs, int rhs) {
+            return voteCounts[lhs] > voteCounts[rhs] || (voteCounts[lhs] == voteCounts[rhs] && lhs < rhs);
+        });
+    votedCandidates.resize(votedCount);
+    CATBOOST_DEBUG_LOG << "Voting selected " << votedCount << " of " << allCandidatesList.size() << " candidates" << Endl;
+
+    NPar::TJobDescription job;
+    NPar::Map(&job, new TRemoteVotedBinCalcer(), &votedCandidates);
+    NPar::RemoteMap(&job, new TRemoteScoreCalcer);
+    NPar::TJobExecutor exec(&job, TMasterEnvironment::GetRef().SharedTrainData);
+    TVector<typename TRemoteScoreCalcer::TOutput> votedScores;
+    exec.GetRemoteMapResults(&votedScores);
+    Y_ASSERT(votedCandidates.size() == votedScores.size());
+
+    // candidates without votes are left with minimal score
+    for (auto& candidatesContext : *candidatesContexts) {
+        for (auto& candidate : candidatesContext.CandidateList) {
+            for (auto& subcandidate : candidate.Candidates) {
+                subcandidate.BestScore = TRandomScore();
+                subcandidate.BestBinId = -1;
+            }
+        }
+    }
+    const ui64 randSeed = ctx->LearnProgress->Rand.GenRand();
+    ctx->LocalExecutor->ExecRange(
+        [&] (int votedIdx) {
+            const int allCandidatesIdx = votedCandidates[votedIdx];
+            const auto [contextIdx, candidateIdx] = contextAndCandidateIdx[allCandidatesIdx];
+            auto& candidatesContext = (*candidatesContexts)[contextIdx];
+            auto& candidates = candidatesContext.CandidateList[candidateIdx].Candidates;
+            Y_VERIFY(candidates.size() > 0);
+
+            SetBestScore(
+                randSeed + allCandidatesIdx,
+                votedScores[votedIdx],
+                scoreStDev,
+                candidatesContext,
+                &candidates);
+        },
+        0,
+        votedCandidates.ysize(),
+        NPar::TLocalExecutor::WAIT_COMPLETE);
+}
+
 void MapRemoteCalcScore(
     double scoreStDev,
     TVector<TCandidatesContext>* candidatesContexts,
     TLearnContext* ctx) {
 
+    const ui32 votingCandidateCount = ctx->Params.SystemOptions->VotingCandidateCount;
+    if (votingCandidateCount > 0) {
+        size_t candidateCount = 0;
+        for (const auto& candidatesContext : *candidatesContexts) {
+            candidateCount += candidatesContext.CandidateList.size();
+        }
+        if (2 * votingCandidateCount < candidateCount) {
+            MapVotingRemoteCalcScore(scoreStDev, candidatesContexts, ctx);
+            return;
+        }
+    }
     MapGenericRemoteCalcScore<TRemoteBinCalcer, TRemoteScoreCalcer>(
         scoreStDev,
         candidatesContexts,
@@ -10,6 +10,15 @@
 #include <catboost/libs/data/loader.h>
 #include <catboost/private/libs/options/load_options.h>
 
+#include <util/generic/strbuf.h>
+#include <util/generic/string.h>
+
+#include <utility>
+
+// Parse a file_with_hosts line: host, host:port, [ipv6 address] or [ipv6 address]:port.
+// Returned address has no brackets, bare ipv6 addresses are rejected as their port can't be told apart
+std::pair<TString, ui16> ParseWorkerHostAndPort(TStringBuf host, ui16 defaultPort);
+
 void InitializeMaster(const NCatboostOptions::TSystemOptions& systemOptions);
 void FinalizeMaster(TLearnContext* ctx);
 void SetTrainDataFromQuantizedPool(
@@ -0,0 +1,69 @@
+#include <catboost/private/libs/distributed/data_types.h>
+
+#include <library/cpp/binsaver/mem_io.h>
+#include <library/cpp/testing/unittest/registar.h>
+
+#include <util/generic/cast.h>
+#include <util/generic/xrange.h>
+
+
+using namespace NCatboostDistributed;
+
+
+static TStats3D MakeStats3D(ui32 bucketCount, ui32 nonEmptyBucketStep) {
+    TStats3D stats3D;
+    stats3D.BucketCount = SafeIntegerCast<int>(bucketCount);
+    stats3D.MaxLeafCount = 1;
+    stats3D.Stats.resize(bucketCount, TBucketStats{0, 0, 0, 0});
+    for (ui32 bucketIdx = 0; bucketIdx < bucketCount; bucketIdx += nonEmptyBucketStep) {
+        stats3D.Stats[bucketIdx] = TBucketStats{0.1 * bucketIdx, 1.5, -0.25 * bucketIdx, 3.0};
+    }
+    return stats3D;
+}
+
+static TVector<char> Serialize(const TStats3D& stats3D, bool isCompact) {
+    TRemoteStats4D remoteStats;
+    remoteStats.Stats = {stats3D};
+    remoteStats.IsCompact = isCompact;
+    TVector<char> data;
+    NMemIoInternals::SerializeMem(/*bRead*/ false, &data, remoteStats);
+    return data;
+}
+
+Y_UNIT_TEST_SUITE(TRemoteStats4DTest) {
+    Y_UNIT_TEST(TestCompactRoundTrip) {
+        const auto stats3D = MakeStats3D(/*bucketCount*/ 100, /*nonEmptyBucketStep*/ 7);
+        auto data = Serialize(stats3D, /*isCompact*/ true);
+
+        TRemoteStats4D loaded;
+        NMemIoInternals::SerializeMem(/*bRead*/ true, &data, loaded);
+        UNIT_ASSERT(loaded.IsCompact);
+        UNIT_ASSERT_VALUES_EQUAL(loaded.Stats.size(), 1);
+        const auto& loadedStats3D = loaded.Stats[0];
+        UNIT_ASSERT_VALUES_EQUAL(loadedStats3D.BucketCount, stats3D.BucketCount);
+        UNIT_ASSERT_VALUES_EQUAL(loadedStats3D.MaxLeafCount, stats3D.MaxLeafCount);
+        UNIT_ASSERT_VALUES_EQUAL(loadedStats3D.Stats.size(), stats3D.Stats.size());
+        for (auto bucketIdx : xrange(stats3D.Stats.size())) {
+            const auto& expected = stats3D.Stats[bucketIdx];
+            const auto& actual = loadedStats3D.Stats[bucketIdx];
+            // values are sent as float
+            UNIT_ASSERT_VALUES_EQUAL(actual.SumWeightedDelta, (double)(float)expected.SumWeightedDelta);
+            UNIT_ASSERT_VALUES_EQUAL(actual.SumWeight, (double)(float)expected.SumWeight);
+            UNIT_ASSERT_VALUES_EQUAL(actual.SumDelta, (double)(float)expected.SumDelta);
+            UNIT_ASSERT_VALUES_EQUAL(actual.Count, (double)(float)expected.Count);
+        }
+    }
+
+    Y_UNIT_TEST(TestCompactSkipsEmptyBuckets) {
+        const ui32 bucketCount = 100;
+        const auto denseData = Serialize(MakeStats3D(bucketCount, /*nonEmptyBucketStep*/ 1), /*isCompact*/ true);
+        const auto sparseData = Serialize(MakeStats3D(bucketCount, /*nonEmptyBucketStep*/ 10), /*isCompact*/ true);
+        const auto plainData = Serialize(MakeStats3D(bucketCount, /*nonEmptyBucketStep*/ 10), /*isCompact*/ false);
+
+        // each nonempty bucket is sent as its index and four floats, empty buckets are not sent at all
+        const size_t compactBucketSize = sizeof(ui32) + 4 * sizeof(float);
+        UNIT_ASSERT_VALUES_EQUAL(denseData.size() - sparseData.size(), (bucketCount - bucketCount / 10) * compactBucketSize);
+        UNIT_ASSERT_GT(plainData.size(), bucketCount * sizeof(TBucketStats));
+        UNIT_ASSERT_LT(sparseData.size(), plainData.size() / 5);
+    }
+}
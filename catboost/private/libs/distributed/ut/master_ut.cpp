@@ -0,0 +1,26 @@
+#include <catboost/private/libs/distributed/master.h>
+
+#include <library/cpp/testing/unittest/registar.h>
+
+
+Y_UNIT_TEST_SUITE(WorkerHosts) {
+    Y_UNIT_TEST(ParseWorkerHostAndPort) {
+        using TAddress = std::pair<TString, ui16>;
+        UNIT_ASSERT_EQUAL(ParseWorkerHostAndPort("localhost", 8000), TAddress("localhost", 8000));
+        UNIT_ASSERT_EQUAL(ParseWorkerHostAndPort("localhost:9000", 8000), TAddress("localhost", 9000));
+        UNIT_ASSERT_EQUAL(ParseWorkerHostAndPort("127.0.0.1:9000", 8000), TAddress("127.0.0.1", 9000));
+        UNIT_ASSERT_EQUAL(ParseWorkerHostAndPort("[::1]", 8000), TAddress("::1", 8000));
+        UNIT_ASSERT_EQUAL(ParseWorkerHostAndPort("[::1]:9000", 8000), TAddress("::1", 9000));
+        UNIT_ASSERT_EQUAL(ParseWorkerHostAndPort("[fe80::1%eth0]:9000", 8000), TAddress("fe80::1%eth0", 9000));
+    }
+
+    Y_UNIT_TEST(ParseInvalidWorkerHostAndPort) {
+        // bare ipv6 address would have its last group taken for the port
+        UNIT_ASSERT_EXCEPTION(ParseWorkerHostAndPort("::1", 8000), TCatBoostException);
+        UNIT_ASSERT_EXCEPTION(ParseWorkerHostAndPort("fe80::1:9000", 8000), TCatBoostException);
+        UNIT_ASSERT_EXCEPTION(ParseWorkerHostAndPort("[::1", 8000), TCatBoostException);
+        UNIT_ASSERT_EXCEPTION(ParseWorkerHostAndPort("[::1]9000", 8000), TCatBoostException);
+        UNIT_ASSERT_EXCEPTION(ParseWorkerHostAndPort("[::1]:", 8000), TCatBoostException);
+        UNIT_ASSERT_EXCEPTION(ParseWorkerHostAndPort(":9000", 8000), TCatBoostException);
+    }
+}
@@ -5,6 +5,7 @@ namespace NCatboostOptions {
         CB_ENSURE((GetTakenFraction() > 0) && (GetTakenFraction() <= 1.0f), "Taken fraction should be in (0,1]");
         CB_ENSURE(GetBaggingTemperature() >= 0, "Bagging temperature should be >= 0");
         CB_ENSURE(GetMvsReg().OrElse(0) >= 0, "MVS regularization parameter should be >= 0");
+        CB_ENSURE((GetGossTopRate() >= 0) && (GetGossTopRate() < 1.0f), "GOSS top rate should be in [0,1)");
 
         if (BootstrapType.NotSet()) {
             return;
@@ -38,6 +39,17 @@ namespace NCatboostOptions {
                 );
                 break;
             }
+            case EBootstrapType::GOSS: {
+                CB_ENSURE(TaskType == ETaskType::CPU, "GOSS bootstrap is supported only on CPU");
+                CB_ENSURE(
+                    GetSamplingUnit() == ESamplingUnit::Object,
+                    "GOSS bootstrap supports per object sampling only."
+                );
+                if (BaggingTemperature.IsSet()) {
+                    ythrow TCatBoostException() << "Error: bagging temperature available for bayesian bootstrap only";
+                }
+                break;
+            }
             default: {
                 Y_ASSERT(type == EBootstrapType::Bernoulli);
                 if (BaggingTemperature.IsSet()) {
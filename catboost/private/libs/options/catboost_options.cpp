@@ -695,6 +695,15 @@ void NCatboostOptions::TCatBoostOptions::Validate() const {
         CB_ENSURE(SystemOptions->IsSingleHost(), "Langevin boosting is supported in single-host mode only.");
     }
 
+    if (GetTaskType() == ETaskType::CPU && ObliviousTreeOptions->FeaturePreselectionCount.Get() > 0) {
+        CB_ENSURE(ObliviousTreeOptions->GrowPolicy == EGrowPolicy::SymmetricTree,
+            "Feature preselection is supported only for SymmetricTree grow policy.");
+        CB_ENSURE(!IsPairwiseScoring(lossFunction),
+            "Feature preselection is unsupported for pairwise loss functions.");
+        CB_ENSURE(SystemOptions->IsSingleHost(),
+            "Feature preselection is unsupported for distributed learning.");
+    }
+
     if (GetTaskType() == ETaskType::CPU && ObliviousTreeOptions->FeaturePenalties.IsSet()) {
         ValidateFeaturePenaltiesOptions(ObliviousTreeOptions->FeaturePenalties.Get());
     }
@@ -738,6 +747,8 @@ void NCatboostOptions::TCatBoostOptions::SetNotSpecifiedOptionsToDefaults() {
     } else {
         if (bootstrapType == EBootstrapType::MVS) {
             subsample.SetDefault(0.8);
+        } else if (bootstrapType == EBootstrapType::GOSS) {
+            subsample.SetDefault(0.1);
         }
     }
 
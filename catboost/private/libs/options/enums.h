@@ -84,6 +84,7 @@ enum class EBootstrapType {
     Bayesian,
     Bernoulli,
     MVS, // Minimal Variance Sampling, scheme of bootstrap with subsampling, which reduces variance in score approximation
+    GOSS, // Gradient-based One-Side Sampling, keeps objects with the largest gradients and subsamples the rest
     No
 };
 
@@ -27,6 +27,8 @@ NCatboostOptions::TObliviousTreeLearnerOptions::TObliviousTreeLearnerOptions(ETa
       , ModelSizeReg("model_size_reg", 0.5f)
       , DevScoreCalcObjBlockSize("dev_score_calc_obj_block_size", 5000000, taskType)
       , SparseFeaturesConflictFraction("sparse_features_conflict_fraction", 0.0f, taskType)
+      , FeaturePreselectionCount("feature_preselection_count", 0, taskType)
+      , FeaturePreselectionSampleRate("feature_preselection_sample_rate", 0.1f, taskType)
       , ObservationsToBootstrap("observations_to_bootstrap", EObservationsToBootstrap::TestOnly, taskType) //it's specific for fold-based scheme, so here and not in bootstrap options
       , FoldSizeLossNormalization("fold_size_loss_normalization", false, taskType)
       , AddRidgeToTargetFunctionFlag("add_ridge_penalty_to_loss_function", false, taskType)
@@ -61,6 +63,8 @@ void NCatboostOptions::TObliviousTreeLearnerOptions::Load(const NJson::TJsonValu
             &DevScoreCalcObjBlockSize,
             &DevExclusiveFeaturesBundleMaxBuckets,
             &SparseFeaturesConflictFraction,
+            &FeaturePreselectionCount,
+            &FeaturePreselectionSampleRate,
             &MonotoneConstraints,
             &DevLeafwiseApproxes,
             &FeaturePenalties
@@ -83,6 +87,8 @@ void NCatboostOptions::TObliviousTreeLearnerOptions::Save(NJson::TJsonValue* opt
             DevScoreCalcObjBlockSize,
             DevExclusiveFeaturesBundleMaxBuckets,
             SparseFeaturesConflictFraction,
+            FeaturePreselectionCount,
+            FeaturePreselectionSampleRate,
             MonotoneConstraints,
             DevLeafwiseApproxes,
             FeaturePenalties
@@ -95,6 +101,7 @@ bool NCatboostOptions::TObliviousTreeLearnerOptions::operator==(const TOblivious
             AddRidgeToTargetFunctionFlag, ScoreFunction, GrowPolicy, MaxLeaves, MinDataInLeaf, MaxCtrComplexityForBordersCaching,
             PairwiseNonDiagReg, LeavesEstimationBacktrackingType, DevScoreCalcObjBlockSize,
             DevExclusiveFeaturesBundleMaxBuckets, SparseFeaturesConflictFraction,
+            FeaturePreselectionCount, FeaturePreselectionSampleRate,
             MonotoneConstraints, DevLeafwiseApproxes, FeaturePenalties
             ) ==
         std::tie(rhs.MaxDepth, rhs.LeavesEstimationIterations, rhs.LeavesEstimationMethod, rhs.L2Reg, rhs.ModelSizeReg,
@@ -103,6 +110,7 @@ bool NCatboostOptions::TObliviousTreeLearnerOptions::operator==(const TOblivious
                 rhs.ScoreFunction, rhs.GrowPolicy, rhs.MaxLeaves, rhs.MinDataInLeaf, rhs.MaxCtrComplexityForBordersCaching,
                 rhs.PairwiseNonDiagReg, rhs.LeavesEstimationBacktrackingType, rhs.DevScoreCalcObjBlockSize,
                 rhs.DevExclusiveFeaturesBundleMaxBuckets, rhs.SparseFeaturesConflictFraction,
+                rhs.FeaturePreselectionCount, rhs.FeaturePreselectionSampleRate,
                 rhs.MonotoneConstraints, rhs.DevLeafwiseApproxes, rhs.FeaturePenalties);
 }
 
@@ -128,6 +136,10 @@ void NCatboostOptions::TObliviousTreeLearnerOptions::Validate() const {
         (SparseFeaturesConflictFraction.GetUnchecked() >= 0.f) && (SparseFeaturesConflictFraction.GetUnchecked() < 1.f),
         "SparseFeaturesConflictFraction should be in [0, 1)"
     );
+    CB_ENSURE(
+        (FeaturePreselectionSampleRate.GetUnchecked() > 0.f) && (FeaturePreselectionSampleRate.GetUnchecked() <= 1.f),
+        "FeaturePreselectionSampleRate should be in (0, 1]"
+    );
     CB_ENSURE(LeavesEstimationIterations.Get() > 0, "Leaves estimation iterations should be positive");
     CB_ENSURE(L2Reg.Get() >= 0, "L2LeafRegularizer should be >= 0, current value: " << L2Reg.Get());
     CB_ENSURE(PairwiseNonDiagReg.Get() >= 0, "PairwiseNonDiagReg should be >= 0, current value: " << PairwiseNonDiagReg.Get());
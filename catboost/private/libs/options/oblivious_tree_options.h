@@ -46,6 +46,10 @@ namespace NCatboostOptions {
 
         TCpuOnlyOption<float> SparseFeaturesConflictFraction;
 
+        // if nonzero, features are first scored on a document subsample and only the best ones are scored exactly
+        TCpuOnlyOption<ui32> FeaturePreselectionCount;
+        TCpuOnlyOption<float> FeaturePreselectionSampleRate;
+
         TGpuOnlyOption<EObservationsToBootstrap> ObservationsToBootstrap;
         TGpuOnlyOption<bool> FoldSizeLossNormalization;
         TGpuOnlyOption<bool> AddRidgeToTargetFunctionFlag;
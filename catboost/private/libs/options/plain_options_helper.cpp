@@ -363,6 +363,8 @@ void NCatboostOptions::PlainJsonToOptions(
     CopyOption(plainOptions, "observations_to_bootstrap", &treeOptions, &seenKeys);
     CopyOption(plainOptions, "monotone_constraints", &treeOptions, &seenKeys);
     CopyOption(plainOptions, "dev_leafwise_approxes", &treeOptions, &seenKeys);
+    CopyOption(plainOptions, "feature_preselection_count", &treeOptions, &seenKeys);
+    CopyOption(plainOptions, "feature_preselection_sample_rate", &treeOptions, &seenKeys);
 
     auto& bootstrapOptions = treeOptions["bootstrap"];
     bootstrapOptions.SetType(NJson::JSON_MAP);
@@ -371,6 +373,7 @@ void NCatboostOptions::PlainJsonToOptions(
     CopyOption(plainOptions, "bagging_temperature", &bootstrapOptions, &seenKeys);
     CopyOption(plainOptions, "subsample", &bootstrapOptions, &seenKeys);
     CopyOption(plainOptions, "mvs_reg", &bootstrapOptions, &seenKeys);
+    CopyOption(plainOptions, "goss_top_rate", &bootstrapOptions, &seenKeys);
     CopyOption(plainOptions, "sampling_unit", &bootstrapOptions, &seenKeys);
 
     auto& featurePenaltiesOptions = treeOptions["penalties"];
@@ -464,6 +467,10 @@ void NCatboostOptions::PlainJsonToOptions(
     CopyOption(plainOptions, "node_type", &systemOptions, &seenKeys);
     CopyOption(plainOptions, "node_port", &systemOptions, &seenKeys);
     CopyOption(plainOptions, "file_with_hosts", &systemOptions, &seenKeys);
+    CopyOption(plainOptions, "pin_threads", &systemOptions, &seenKeys);
+    CopyOption(plainOptions, "compact_distributed_stats", &systemOptions, &seenKeys);
+    CopyOption(plainOptions, "voting_candidate_count", &systemOptions, &seenKeys);
+    CopyOption(plainOptions, "skip_unavailable_workers", &systemOptions, &seenKeys);
 
 
     //rest
@@ -701,6 +708,12 @@ void NCatboostOptions::ConvertOptionsToPlainJson(
         CopyOption(treeOptions, "dev_leafwise_approxes", &plainOptionsJson, &seenKeys);
         DeleteSeenOption(&optionsCopyTree, "dev_leafwise_approxes");
 
+        CopyOption(treeOptions, "feature_preselection_count", &plainOptionsJson, &seenKeys);
+        DeleteSeenOption(&optionsCopyTree, "feature_preselection_count");
+
+        CopyOption(treeOptions, "feature_preselection_sample_rate", &plainOptionsJson, &seenKeys);
+        DeleteSeenOption(&optionsCopyTree, "feature_preselection_sample_rate");
+
         // bootstrap
         if (treeOptions.Has("bootstrap")) {
             const auto& bootstrapOptions = treeOptions["bootstrap"];
@@ -718,6 +731,9 @@ void NCatboostOptions::ConvertOptionsToPlainJson(
             CopyOption(bootstrapOptions, "mvs_reg", &plainOptionsJson, &seenKeys);
             DeleteSeenOption(&optionsCopyTreeBootstrap, "mvs_reg");
 
+            CopyOption(bootstrapOptions, "goss_top_rate", &plainOptionsJson, &seenKeys);
+            DeleteSeenOption(&optionsCopyTreeBootstrap, "goss_top_rate");
+
             CopyOption(bootstrapOptions, "sampling_unit", &plainOptionsJson, &seenKeys);
             DeleteSeenOption(&optionsCopyTreeBootstrap, "sampling_unit");
 
@@ -926,6 +942,18 @@ void NCatboostOptions::ConvertOptionsToPlainJson(
         CopyOption(systemOptions, "file_with_hosts", &plainOptionsJson, &seenKeys);
         DeleteSeenOption(&optionsCopySystemOptions, "file_with_hosts");
 
+        CopyOption(systemOptions, "pin_threads", &plainOptionsJson, &seenKeys);
+        DeleteSeenOption(&optionsCopySystemOptions, "pin_threads");
+
+        CopyOption(systemOptions, "compact_distributed_stats", &plainOptionsJson, &seenKeys);
+        DeleteSeenOption(&optionsCopySystemOptions, "compact_distributed_stats");
+
+        CopyOption(systemOptions, "voting_candidate_count", &plainOptionsJson, &seenKeys);
+        DeleteSeenOption(&optionsCopySystemOptions, "voting_candidate_count");
+
+        CopyOption(systemOptions, "skip_unavailable_workers", &plainOptionsJson, &seenKeys);
+        DeleteSeenOption(&optionsCopySystemOptions, "skip_unavailable_workers");
+
         CB_ENSURE(optionsCopySystemOptions.GetMapSafe().empty(), "system_options: key " + optionsCopySystemOptions.GetMapSafe().begin()->first + " wasn't added to plain options.");
         DeleteSeenOption(&optionsCopy, "system_options");
     }
@@ -967,6 +995,9 @@ void NCatboostOptions::CleanPlainJson(
     DeleteSeenOption(plainOptionsJsonEfficient, "node_port");
     DeleteSeenOption(plainOptionsJsonEfficient, "file_with_hosts");
     DeleteSeenOption(plainOptionsJsonEfficient, "node_type");
+    DeleteSeenOption(plainOptionsJsonEfficient, "compact_distributed_stats");
+    DeleteSeenOption(plainOptionsJsonEfficient, "voting_candidate_count");
+    DeleteSeenOption(plainOptionsJsonEfficient, "skip_unavailable_workers");
 
     // options with no influence on the final model
     DeleteSeenOption(plainOptionsJsonEfficient, "objective_metric");
@@ -974,6 +1005,7 @@ void NCatboostOptions::CleanPlainJson(
     DeleteSeenOption(plainOptionsJsonEfficient, "allow_const_label");
     DeleteSeenOption(plainOptionsJsonEfficient, "detailed_profile");
     DeleteSeenOption(plainOptionsJsonEfficient, "logging_level");
+    DeleteSeenOption(plainOptionsJsonEfficient, "pin_threads");
 
     if (!hasCatFeatures) {
         DeleteSeenOption(plainOptionsJsonEfficient, "simple_ctrs");
@@ -17,6 +17,10 @@ TSystemOptions::TSystemOptions(ETaskType taskType)
     , NodeType("node_type", ENodeType::SingleHost, taskType)
     , FileWithHosts("file_with_hosts", "hosts.txt", taskType)
     , NodePort("node_port", GetUnusedNodePort(), taskType)
+    , PinThreads("pin_threads", false, taskType)
+    , CompactDistributedStats("compact_distributed_stats", false, taskType)
+    , VotingCandidateCount("voting_candidate_count", 0, taskType)
+    , SkipUnavailableWorkers("skip_unavailable_workers", false, taskType)
 {
     Devices.ChangeLoadUnimplementedPolicy(ELoadUnimplementedPolicy::SkipWithWarning);
     GpuRamPart.ChangeLoadUnimplementedPolicy(ELoadUnimplementedPolicy::SkipWithWarning);
@@ -24,18 +28,23 @@ TSystemOptions::TSystemOptions(ETaskType taskType)
 }
 
 void TSystemOptions::Load(const NJson::TJsonValue& options) {
-    CheckedLoad(options, &NumThreads, &CpuUsedRamLimit, &Devices, &GpuRamPart, &PinnedMemorySize, &NodeType, &FileWithHosts, &NodePort);
+    CheckedLoad(options, &NumThreads, &CpuUsedRamLimit, &Devices, &GpuRamPart, &PinnedMemorySize, &NodeType, &FileWithHosts, &NodePort, &PinThreads,
+        &CompactDistributedStats, &VotingCandidateCount, &SkipUnavailableWorkers);
 }
 
 void TSystemOptions::Save(NJson::TJsonValue* options) const {
-    SaveFields(options, NumThreads, CpuUsedRamLimit, Devices, GpuRamPart, PinnedMemorySize, NodeType, FileWithHosts, NodePort);
+    SaveFields(options, NumThreads, CpuUsedRamLimit, Devices, GpuRamPart, PinnedMemorySize, NodeType, FileWithHosts, NodePort, PinThreads,
+        CompactDistributedStats, VotingCandidateCount, SkipUnavailableWorkers);
 }
 
 bool TSystemOptions::operator==(const TSystemOptions& rhs) const {
     return std::tie(NumThreads, CpuUsedRamLimit, Devices,
-                    GpuRamPart, PinnedMemorySize, NodeType, FileWithHosts, NodePort) ==
+                    GpuRamPart, PinnedMemorySize, NodeType, FileWithHosts, NodePort, PinThreads,
+                    CompactDistributedStats, VotingCandidateCount, SkipUnavailableWorkers) ==
            std::tie(rhs.NumThreads, rhs.CpuUsedRamLimit, rhs.Devices,
-                    rhs.GpuRamPart, rhs.PinnedMemorySize, rhs.NodeType, rhs.FileWithHosts, rhs.NodePort);
+                    rhs.GpuRamPart, rhs.PinnedMemorySize, rhs.NodeType, rhs.FileWithHosts, rhs.NodePort,
+                    rhs.PinThreads, rhs.CompactDistributedStats,
+                    rhs.VotingCandidateCount, rhs.SkipUnavailableWorkers);
 }
 
 bool TSystemOptions::operator!=(const TSystemOptions& rhs) const {
@@ -29,6 +29,10 @@ namespace NCatboostOptions {
         TCpuOnlyOption<ENodeType> NodeType;
         TCpuOnlyOption<TString> FileWithHosts;
         TCpuOnlyOption<ui32> NodePort;
+        TCpuOnlyOption<bool> PinThreads;
+        TCpuOnlyOption<bool> CompactDistributedStats;
+        TCpuOnlyOption<ui32> VotingCandidateCount;
+        TCpuOnlyOption<bool> SkipUnavailableWorkers;
 
         static ui32 GetUnusedNodePort() { return 0; }
         bool IsMaster() const;
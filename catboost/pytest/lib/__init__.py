@@ -155,13 +155,15 @@ def format_crossvalidation(is_inverted, n, k):
     return '{}:{};{}'.format(cv_type, n, k)
 
 
-def execute_dist_train(cmd):
+def execute_dist_train(cmd, unavailable_worker_count=0, stdout=None):
     hosts_path = yatest.common.test_output_path('hosts.txt')
     with yatest.common.network.PortManager() as pm:
         port0 = pm.get_port()
         port1 = pm.get_port()
         with open(hosts_path, 'w') as hosts:
             hosts.write('localhost:' + str(port0) + '\n')
+            for _ in range(unavailable_worker_count):
+                hosts.write('localhost:' + str(pm.get_port()) + '\n')
             hosts.write('localhost:' + str(port1) + '\n')
 
         catboost_path = yatest.common.binary_path("catboost/app/catboost")
@@ -172,7 +174,8 @@ def execute_dist_train(cmd):
 
         execute_catboost_fit(
             'CPU',
-            cmd + ('--node-type', 'Master', '--file-with-hosts', hosts_path,)
+            cmd + ('--node-type', 'Master', '--file-with-hosts', hosts_path,),
+            stdout=stdout
         )
         worker0.wait()
         worker1.wait()
@@ -1524,6 +1524,42 @@ def test_sample_id(loss_function, column_name):
 POOLS = ['amazon', 'adult']
 
 
+def test_calc_output_in_blocks():
+    # with eval period 1 and 400 trees calc reads the pool in blocks of 32 objects,
+    # output of a block is written while the next block is evaluated
+    model_path = yatest.common.test_output_path('adult_model.bin')
+    cmd = (
+        '--loss-function', 'Logloss',
+        '-f', data_file('adult', 'train_small'),
+        '--column-description', data_file('adult', 'train.cd'),
+        '-i', '400',
+        '-T', '4',
+        '-m', model_path,
+    )
+    execute_catboost_fit('CPU', cmd)
+
+    def calc(eval_period):
+        output_eval_path = yatest.common.test_output_path('test_{}.eval'.format(eval_period))
+        yatest.common.execute((
+            CATBOOST_PATH,
+            'calc',
+            '--input-path', data_file('adult', 'test_small'),
+            '--column-description', data_file('adult', 'train.cd'),
+            '-m', model_path,
+            '--output-path', output_eval_path,
+            '--prediction-type', 'RawFormulaVal',
+            '--eval-period', eval_period,
+        ))
+        return np.loadtxt(output_eval_path, skiprows=1, ndmin=2)
+
+    blocked = calc('1')
+    single_block = calc('400')
+    assert blocked.shape == (101, 401)
+    assert np.all(blocked[:, 0] == np.arange(101))
+    assert np.all(single_block[:, 0] == np.arange(101))
+    assert np.allclose(blocked[:, -1], single_block[:, 1], rtol=1e-9, atol=1e-12)
+
+
 @pytest.mark.parametrize('boosting_type, grow_policy', BOOSTING_TYPE_WITH_GROW_POLICIES)
 def test_apply_missing_vals(boosting_type, grow_policy):
     model_path = yatest.common.test_output_path('adult_model.bin')
@@ -5011,6 +5047,95 @@ def test_dist_train_auc_weight(loss_func):
     ), output_file_switch='--test-err-log'))]
 
 
+def test_dist_train_compact_stats():
+    train_cmd = make_deterministic_train_cmd(
+        loss_function='Logloss',
+        pool='higgs',
+        train='train_small',
+        test='test_small',
+        cd='train.cd')
+
+    eval_path = yatest.common.test_output_path('test.eval')
+    execute_dist_train(train_cmd + ('--eval-file', eval_path,))
+
+    compact_eval_path = yatest.common.test_output_path('test_compact.eval')
+    execute_dist_train(train_cmd + ('--eval-file', compact_eval_path, '--compact-distributed-stats'))
+
+    eval = np.loadtxt(eval_path, dtype='float', delimiter='\t', skiprows=1)
+    compact_eval = np.loadtxt(compact_eval_path, dtype='float', delimiter='\t', skiprows=1)
+    # stats are sent as floats, so only float32 rounding differences are allowed
+    float32_eps = np.finfo(np.float32).eps
+    assert(np.allclose(eval, compact_eval, rtol=16 * float32_eps, atol=16 * float32_eps))
+
+
+@pytest.mark.parametrize('voting_candidate_count', [1, 5, 100])
+def test_dist_train_voting(voting_candidate_count):
+    train_cmd = make_deterministic_train_cmd(
+        loss_function='Logloss',
+        pool='higgs',
+        train='train_small',
+        test='test_small',
+        cd='train.cd',
+        other_options=('--voting-candidate-count', str(voting_candidate_count)))
+
+    eval_path = yatest.common.test_output_path('test.eval')
+    execute_dist_train(train_cmd + ('--eval-file', eval_path,))
+    eval = np.loadtxt(eval_path, dtype='float', delimiter='\t', skiprows=1)
+    assert(np.all(np.isfinite(eval)))
+
+    if voting_candidate_count == 100:
+        # all candidates are aggregated, so the result matches single host training
+        run_dist_train(train_cmd)
+
+
+def test_dist_train_voting_quality():
+    # higgs has 28 float features, so 2 * 2 < 28 and candidates are voted for on every depth
+    train_cmd = make_deterministic_train_cmd(
+        loss_function='Logloss',
+        pool='higgs',
+        train='train_small',
+        test='test_small',
+        cd='train.cd')
+
+    test_error_path = yatest.common.test_output_path('test_error.tsv')
+    execute_dist_train(train_cmd + ('--test-err-log', test_error_path))
+
+    voting_test_error_path = yatest.common.test_output_path('voting_test_error.tsv')
+    voting_log_path = yatest.common.test_output_path('voting.log')
+    with open(voting_log_path, 'w') as voting_log:
+        execute_dist_train(
+            train_cmd + ('--test-err-log', voting_test_error_path, '--voting-candidate-count', '2', '--logging-level', 'Debug'),
+            stdout=voting_log)
+
+    with open(voting_log_path) as voting_log:
+        assert 'Voting selected' in voting_log.read()
+
+    test_error = np.loadtxt(test_error_path, dtype='float', delimiter='\t', skiprows=1)
+    voting_test_error = np.loadtxt(voting_test_error_path, dtype='float', delimiter='\t', skiprows=1)
+    assert voting_test_error[-1, 1] < test_error[-1, 1] * 1.02
+
+
+def test_dist_train_skip_unavailable_workers():
+    train_cmd = make_deterministic_train_cmd(
+        loss_function='Logloss',
+        pool='higgs',
+        train='train_small',
+        test='test_small',
+        cd='train.cd')
+
+    eval_path = yatest.common.test_output_path('test.eval')
+    execute_catboost_fit('CPU', train_cmd + ('--eval-file', eval_path,))
+
+    dist_eval_path = yatest.common.test_output_path('test_dist.eval')
+    execute_dist_train(
+        train_cmd + ('--eval-file', dist_eval_path, '--skip-unavailable-workers'),
+        unavailable_worker_count=1)
+
+    eval = np.loadtxt(eval_path, dtype='float', delimiter='\t', skiprows=1)
+    dist_eval = np.loadtxt(dist_eval_path, dtype='float', delimiter='\t', skiprows=1)
+    assert(np.allclose(eval, dist_eval, atol=1e-5))
+
+
 @pytest.mark.xfail(reason='Boost from average for distributed training')
 @pytest.mark.parametrize('schema,train', [('quantized://', 'train_small_x128_greedylogsum.bin'), ('', 'train_small')])
 def test_dist_train_snapshot(schema, train):
@@ -5214,6 +5339,39 @@ def test_eval_metrics_with_target_border_and_class_weights():
     )
 
 
+def test_eval_metrics_in_blocks():
+    # additive metrics of a block are calculated while the next block is read,
+    # results must not depend on the number of blocks
+    output_model_path = yatest.common.test_output_path('model.bin')
+    cmd = (
+        '--loss-function', 'Logloss',
+        '-f', data_file('adult', 'train_small'),
+        '--column-description', data_file('adult', 'train.cd'),
+        '-i', '20',
+        '-T', '4',
+        '-m', output_model_path,
+    )
+    execute_catboost_fit('CPU', cmd)
+
+    eval_paths = []
+    for block_size in ('10', '1000'):
+        eval_path = yatest.common.test_output_path('output_{}.tsv'.format(block_size))
+        yatest.common.execute((
+            CATBOOST_PATH,
+            'eval-metrics',
+            '--metrics', 'Logloss,AUC,Accuracy',
+            '--input-path', data_file('adult', 'test_small'),
+            '--column-description', data_file('adult', 'train.cd'),
+            '-m', output_model_path,
+            '-o', eval_path,
+            '--block-size', block_size,
+            '--eval-period', '1',
+        ))
+        eval_paths.append(eval_path)
+
+    assert np.allclose(np.loadtxt(eval_paths[0], skiprows=1), np.loadtxt(eval_paths[1], skiprows=1), rtol=1e-9)
+
+
 @pytest.mark.parametrize('config', [('Constant', 0.2, 0.1), ('Constant', 2, 0.1), ('Decreasing', 0.2, 0.1)])
 def test_eval_metrics_with_boost_from_average_and_model_shrinkage(config):
     mode, rate, lr = config
@@ -5965,6 +6123,55 @@ def test_multiple_eval_sets_err_log():
             local_canonical_file(remove_time_from_json(json_log_path))]
 
 
+def test_multiple_eval_sets_non_additive_metrics():
+    # non-additive eval metrics are calculated in parallel with the additive ones,
+    # check that every eval set still gets its own values in the original order
+    num_tests = 3
+    train_path = data_file('adult', 'train_small')
+    cd_path = data_file('adult', 'train.cd')
+    test_input_path = data_file('adult', 'test_small')
+    model_path = yatest.common.test_output_path('model.bin')
+    test_err_log_path = yatest.common.test_output_path('test-err.log')
+    test_paths = split_test_to(num_tests, test_input_path)
+    metrics = ['AUC', 'Logloss', 'PRAUC']
+    cmd = ('--loss-function', 'Logloss',
+           '-f', train_path,
+           '-t', ','.join(test_paths),
+           '--column-description', cd_path,
+           '--custom-metric', ','.join(metrics),
+           '-i', '10',
+           '-T', '4',
+           '-m', model_path,
+           '--use-best-model', 'false',
+           '--test-err-log', test_err_log_path,
+           )
+    execute_catboost_fit('CPU', cmd)
+
+    fit_header = open(test_err_log_path).readline().rstrip('\n').split('\t')[1:]
+    fit_metrics = np.loadtxt(test_err_log_path, skiprows=1)[:, 1:]
+    assert len(fit_header) % num_tests == 0
+    metrics_per_test = len(fit_header) // num_tests
+    for test_idx, test_path in enumerate(test_paths):
+        eval_path = yatest.common.test_output_path('eval_metrics_{}.tsv'.format(test_idx))
+        yatest.common.execute((
+            CATBOOST_PATH,
+            'eval-metrics',
+            '--metrics', ','.join(metrics),
+            '--input-path', test_path,
+            '--column-description', cd_path,
+            '-m', model_path,
+            '-o', eval_path,
+            '--block-size', '100',
+        ))
+        eval_header = open(eval_path).readline().rstrip('\n').split('\t')
+        eval_metrics = np.loadtxt(eval_path, skiprows=1)
+        test_header = fit_header[test_idx * metrics_per_test:(test_idx + 1) * metrics_per_test]
+        for metric in metrics:
+            fit_values = fit_metrics[:, test_idx * metrics_per_test + test_header.index(metric)]
+            eval_values = eval_metrics[:, eval_header.index(metric)]
+            assert np.all(np.round(fit_values, 8) == np.round(eval_values, 8)), metric
+
+
 # Cast<float>(CityHash('Quvena')) is QNaN
 # Cast<float>(CityHash('Sineco')) is SNaN
 @pytest.mark.parametrize('cat_value', ['Normal', 'Quvena', 'Sineco'])
@@ -7709,6 +7916,110 @@ def test_mvs_bootstrap(boosting_type):
     return [local_canonical_file(ref_eval_path)]
 
 
+@pytest.mark.parametrize('boosting_type', BOOSTING_TYPE)
+def test_goss_bootstrap(boosting_type):
+    def run_catboost(eval_path, test_error_path, bootstrap_args):
+        cmd = [
+            '--use-best-model', 'false',
+            '--allow-writing-files', 'false',
+            '--loss-function', 'RMSE',
+            '-f', data_file('adult', 'train_small'),
+            '-t', data_file('adult', 'test_small'),
+            '--column-description', data_file('adult', 'train.cd'),
+            '--boosting-type', boosting_type,
+            '-i', '50',
+            '-w', '0.03',
+            '-T', '4',
+            '-r', '0',
+            '--eval-file', eval_path,
+            '--test-err-log', test_error_path,
+        ]
+        execute_catboost_fit('CPU', cmd + bootstrap_args)
+
+    def get_final_test_error(test_error_path):
+        return np.loadtxt(test_error_path, dtype='float', delimiter='\t', skiprows=1)[-1, 1]
+
+    no_sampling_eval_path = yatest.common.test_output_path('test_no_sampling.eval')
+    no_sampling_test_error_path = yatest.common.test_output_path('test_error_no_sampling.tsv')
+    run_catboost(no_sampling_eval_path, no_sampling_test_error_path, ['--bootstrap-type', 'No'])
+    no_sampling_test_error = get_final_test_error(no_sampling_test_error_path)
+
+    ref_eval_path = yatest.common.test_output_path('test.eval')
+    ref_test_error_path = yatest.common.test_output_path('test_error.tsv')
+    run_catboost(ref_eval_path, ref_test_error_path, ['--bootstrap-type', 'GOSS'])
+    assert get_final_test_error(ref_test_error_path) < no_sampling_test_error * 1.05
+
+    for top_rate, other_rate in (('0.2', '0.5'), ('0.5', '0.1')):
+        eval_path = yatest.common.test_output_path('test_{}_{}.eval'.format(top_rate, other_rate))
+        test_error_path = yatest.common.test_output_path('test_error_{}_{}.tsv'.format(top_rate, other_rate))
+        run_catboost(
+            eval_path,
+            test_error_path,
+            ['--bootstrap-type', 'GOSS', '--goss-top-rate', top_rate, '--subsample', other_rate])
+        assert (filecmp.cmp(ref_eval_path, eval_path) is False)
+        assert get_final_test_error(test_error_path) < no_sampling_test_error * 1.05
+
+
+@pytest.mark.parametrize('boosting_type', BOOSTING_TYPE)
+def test_feature_preselection(boosting_type):
+    def run_catboost(eval_path, test_error_path, extra_args):
+        cmd = [
+            '--use-best-model', 'false',
+            '--allow-writing-files', 'false',
+            '--loss-function', 'Logloss',
+            '-f', data_file('adult', 'train_small'),
+            '-t', data_file('adult', 'test_small'),
+            '--column-description', data_file('adult', 'train.cd'),
+            '--boosting-type', boosting_type,
+            '-i', '20',
+            '-w', '0.03',
+            '-T', '4',
+            '-r', '0',
+            '--eval-file', eval_path,
+            '--test-err-log', test_error_path,
+        ] + extra_args
+        execute_catboost_fit('CPU', cmd)
+
+    def get_final_test_error(test_error_path):
+        return np.loadtxt(test_error_path, dtype='float', delimiter='\t', skiprows=1)[-1, 1]
+
+    ref_eval_path = yatest.common.test_output_path('test.eval')
+    ref_test_error_path = yatest.common.test_output_path('test_error.tsv')
+    run_catboost(ref_eval_path, ref_test_error_path, [])
+
+    # preselection is skipped when there are not more candidates than the preselection count
+    eval_path = yatest.common.test_output_path('test_all_selected.eval')
+    test_error_path = yatest.common.test_output_path('test_error_all_selected.tsv')
+    run_catboost(eval_path, test_error_path, ['--feature-preselection-count', '1000'])
+    assert filecmp.cmp(ref_eval_path, eval_path)
+
+    # adult has more than 3 candidates, so only the preselected ones are scored on the full data
+    eval_path = yatest.common.test_output_path('test_preselected.eval')
+    test_error_path = yatest.common.test_output_path('test_error_preselected.tsv')
+    run_catboost(eval_path, test_error_path, ['--feature-preselection-count', '3', '--feature-preselection-sample-rate', '0.3'])
+    assert not filecmp.cmp(ref_eval_path, eval_path)
+    assert get_final_test_error(test_error_path) < get_final_test_error(ref_test_error_path) * 1.05
+
+
+@pytest.mark.parametrize(
+    'extra_args',
+    [
+        ['--loss-function', 'PairLogit', '-f', data_file('querywise', 'train'), '--column-description', data_file('querywise', 'train.cd')],
+        ['--loss-function', 'Logloss', '-f', data_file('adult', 'train_small'), '--column-description', data_file('adult', 'train.cd'), '--grow-policy', 'Depthwise'],
+        ['--loss-function', 'Logloss', '-f', data_file('adult', 'train_small'), '--column-description', data_file('adult', 'train.cd'), '--grow-policy', 'Lossguide'],
+    ],
+    ids=['pairwise', 'depthwise', 'lossguide']
+)
+def test_feature_preselection_unsupported(extra_args):
+    cmd = [
+        '-i', '2',
+        '-T', '4',
+        '--feature-preselection-count', '3',
+    ] + extra_args
+    with pytest.raises(yatest.common.ExecutionError):
+        execute_catboost_fit('CPU', cmd)
+
+
 def test_simple_ctr():
     output_model_path = yatest.common.test_output_path('model.bin')
     output_eval_path = yatest.common.test_output_path('test.eval')
@@ -7752,6 +8063,31 @@ def test_output_options():
     return local_canonical_file(os.path.join(train_dir, output_options_path))
 
 
+def test_pin_threads():
+    train_path = data_file('adult', 'train_small')
+    test_path = data_file('adult', 'test_small')
+    cd_path = data_file('adult', 'train.cd')
+
+    def run_catboost(eval_path, additional_params=()):
+        cmd = (
+            '--loss-function', 'Logloss',
+            '-f', train_path,
+            '-t', test_path,
+            '--column-description', cd_path,
+            '-i', '20',
+            '-T', '4',
+            '--eval-file', eval_path,
+            '--use-best-model', 'false',
+        ) + additional_params
+        execute_catboost_fit('CPU', cmd)
+
+    eval_path = yatest.common.test_output_path('test.eval')
+    pinned_eval_path = yatest.common.test_output_path('test_pinned.eval')
+    run_catboost(eval_path)
+    run_catboost(pinned_eval_path, ('--pin-threads',))
+    assert filecmp.cmp(eval_path, pinned_eval_path)
+
+
 def test_target_border():
     output_eval_path = yatest.common.test_output_path('test.eval')
     cmd = (
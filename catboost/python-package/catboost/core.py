@@ -2713,6 +2713,9 @@ class CatBoost(_CatBoostBase):
                 * pmml_copyright : string
                 * pmml_description : string
                 * pmml_model_version : string
+            Parameters for C++ export:
+                * cpp_applier : string - either 'default' or 'batched'
+                  ('batched' generates allocation-free ApplyCatboostModelBatch, models without categorical features only)
         pool : catboost.Pool or list or numpy.ndarray or pandas.DataFrame or pandas.Series or catboost.FeaturesData
             Training pool.
         """
@@ -3867,17 +3870,23 @@ class CatBoostClassifier(CatBoost):
         String format is: '0' for 1 device or '0:1:3' for multiple devices or '0-3' for range of devices.
         List format is : [0] for 1 device or [0,1,3] for multiple devices.
 
-    bootstrap_type : string, Bayesian, Bernoulli, Poisson, MVS.
+    bootstrap_type : string, Bayesian, Bernoulli, Poisson, MVS, GOSS.
         Default bootstrap is Bayesian for GPU and MVS for CPU.
         Poisson bootstrap is supported only on GPU.
-        MVS bootstrap is supported only on CPU.
+        MVS and GOSS bootstraps are supported only on CPU.
 
     subsample : float, [default=None]
         Sample rate for bagging. This parameter can be used Poisson or Bernoully bootstrap types.
+        For GOSS bootstrap it is the sample rate of objects outside of the goss_top_rate fraction,
+        default is 0.1.
 
     mvs-reg : float, [default is set automatically at each iteration based on gradient distribution]
         Regularization parameter for MVS sampling algorithm
 
+    goss_top_rate : float, [default=0.2]
+        Fraction of objects with the largest gradients that GOSS sampling always keeps.
+        The remaining objects are sampled with rate subsample.
+
     monotone_constraints : list or numpy.ndarray or string or dict, [default=None]
         Monotone constraints for features.
 
@@ -3919,6 +3928,15 @@ class CatBoostClassifier(CatBoost):
         CPU only. Maximum allowed fraction of conflicting non-default values for features in exclusive features bundle.
         Should be a real value in [0, 1) interval.
 
+    feature_preselection_count : int, [default=0]
+        CPU only. If nonzero, all features are first scored on a document subsample
+        and exact scores are computed only for this number of the best ones.
+        Supported only for single host training of symmetric trees with non-pairwise loss functions.
+
+    feature_preselection_sample_rate : float, [default=0.1]
+        CPU only. Fraction of sampled documents used for feature preselection.
+        Should be a real value in (0, 1] interval.
+
     grow_policy : string, [SymmetricTree,Lossguide,Depthwise], [default=SymmetricTree]
         The tree growing policy. It describes how to perform greedy tree construction.
 
@@ -4141,11 +4159,14 @@ class CatBoostClassifier(CatBoost):
         bootstrap_type=None,
         subsample=None,
         mvs_reg=None,
+        goss_top_rate=None,
         sampling_unit=None,
         sampling_frequency=None,
         dev_score_calc_obj_block_size=None,
         dev_efb_max_buckets=None,
         sparse_features_conflict_fraction=None,
+        feature_preselection_count=None,
+        feature_preselection_sample_rate=None,
         max_depth=None,
         n_estimators=None,
         num_boost_round=None,
@@ -4702,11 +4723,14 @@ class CatBoostRegressor(CatBoost):
         bootstrap_type=None,
         subsample=None,
         mvs_reg=None,
+        goss_top_rate=None,
         sampling_frequency=None,
         sampling_unit=None,
         dev_score_calc_obj_block_size=None,
         dev_efb_max_buckets=None,
         sparse_features_conflict_fraction=None,
+        feature_preselection_count=None,
+        feature_preselection_sample_rate=None,
         max_depth=None,
         n_estimators=None,
         num_boost_round=None,
@@ -3691,6 +3691,21 @@ def test_shap_feature_importance_modes(task_type, calc_shap_mode):
         assert np.all(np.abs(shaps_for_modes[i] - shaps_for_modes[i - 1]) < 1e-9)
 
 
+@pytest.mark.parametrize('shap_calc_type', ['Regular', 'Approximate', 'Exact'])
+@pytest.mark.parametrize('loss_function', ['Logloss', 'MultiClass'])
+def test_shap_precalc_leaf_tables_match_recursive(task_type, shap_calc_type, loss_function):
+    if loss_function == 'MultiClass':
+        pool = Pool(CLOUDNESS_TRAIN_FILE, column_description=CLOUDNESS_CD_FILE)
+    else:
+        pool = Pool(TRAIN_FILE, column_description=CD_FILE)
+    model = CatBoost({'iterations': 20, 'depth': 5, 'loss_function': loss_function, 'task_type': task_type, 'devices': '0'})
+    model.fit(pool)
+    precalc_shaps = model.get_feature_importance(type=EFstrType.ShapValues, data=pool, shap_mode='UsePreCalc', shap_calc_type=shap_calc_type)
+    recursive_shaps = model.get_feature_importance(type=EFstrType.ShapValues, data=pool, shap_mode='NoPreCalc', shap_calc_type=shap_calc_type)
+    assert precalc_shaps.shape == recursive_shaps.shape
+    assert np.allclose(precalc_shaps, recursive_shaps, rtol=0, atol=1e-9)
+
+
 def test_shap_feature_probability(task_type):
     pool = Pool(TRAIN_FILE, column_description=CD_FILE)
     reference_data = make_reference_data(pool, "IndependentTreeSHAP")
@@ -1,5 +1,7 @@
 #include "perftest_module.h"
 
+#include <catboost/libs/model/cpu/quantization.h>
+
 class TBaseCatboostModule : public TBasePerftestModule {
 public:
     TBaseCatboostModule() = default;
@@ -77,3 +79,76 @@ public:
 };
 
 TPerftestModuleFactory::TRegistrator<TGPUCatboostModule> GPUCatboostModuleRegistar("GPUCatboostModule");
+
+template <bool UseBinarySearch>
+class TCPUFloatBinarizationModule : public TBasePerftestModule {
+public:
+    TCPUFloatBinarizationModule(const TFullModel& model)
+        : Model(model)
+    {
+        CB_ENSURE(!Model.ModelTrees->GetFloatFeatures().empty(), "model has no float features");
+        BaseName = UseBinarySearch ? "float binarization binary search" : "float binarization linear";
+    }
+
+    int GetComparisonPriority(EPerftestModuleDataLayout) const override {
+        return -1;
+    }
+
+    bool SupportsLayout(EPerftestModuleDataLayout layout) const override {
+        return layout == EPerftestModuleDataLayout::FeaturesFirst;
+    }
+
+    double Do(EPerftestModuleDataLayout, TConstArrayRef<TConstArrayRef<float>> features) override {
+        using namespace NCB::NModelEvaluation;
+
+        const size_t docCount = features[0].size();
+        size_t bucketCount = 0;
+        for (const auto& floatFeature : Model.ModelTrees->GetFloatFeatures()) {
+            bucketCount += (floatFeature.Borders.size() + MAX_VALUES_PER_BIN - 1) / MAX_VALUES_PER_BIN;
+        }
+        TVector<ui8> binarized(bucketCount * docCount, 0);
+        const auto floatAccessor = [features](TFeaturePosition position, size_t index) {
+            return features[position.FlatIndex][index];
+        };
+
+        Timer.Reset();
+        ui8* resultPtr = binarized.data();
+        for (size_t start = 0; start < docCount; start += FORMULA_EVALUATION_BLOCK_SIZE) {
+            const size_t blockDocCount = Min(docCount - start, FORMULA_EVALUATION_BLOCK_SIZE);
+            for (const auto& floatFeature : Model.ModelTrees->GetFloatFeatures()) {
+                if (floatFeature.Borders.empty()) {
+                    continue;
+                }
+                if (UseBinarySearch) {
+                    BinarizeFloatsBinarySearch<false>(
+                        floatFeature.Position,
+                        blockDocCount,
+                        floatAccessor,
+                        floatFeature.Borders,
+                        start,
+                        resultPtr);
+                } else {
+                    BinarizeFloatsLinear<false>(
+                        floatFeature.Position,
+                        blockDocCount,
+                        floatAccessor,
+                        floatFeature.Borders,
+                        start,
+                        resultPtr);
+                }
+            }
+        }
+        return Timer.Passed();
+    }
+
+    TString GetName(TMaybe<EPerftestModuleDataLayout>) const override {
+        return BaseName;
+    }
+
+private:
+    const TFullModel& Model;
+    TString BaseName;
+};
+
+TPerftestModuleFactory::TRegistrator<TCPUFloatBinarizationModule<false>> CPUFloatBinarizationLinearModuleRegistar("CPUFloatBinarizationLinear");
+TPerftestModuleFactory::TRegistrator<TCPUFloatBinarizationModule<true>> CPUFloatBinarizationBinarySearchModuleRegistar("CPUFloatBinarizationBinarySearch");